@@ -28,6 +28,8 @@
 \defgroup cs coordinate systems
 \defgroup difference difference: difference of two geometries
 \defgroup disjoint disjoint: detect if geometries are not spatially related
+\defgroup discrete_frechet_distance discrete_frechet_distance: calculate the discrete Frechet distance between two linestrings
+\defgroup discrete_hausdorff_distance discrete_hausdorff_distance: calculate the discrete Hausdorff distance between two geometries
 \defgroup distance distance: calculate distance between two geometries
 \defgroup enum enum: enumerations
 \defgroup envelope envelope: calculate envelope (minimum bounding rectangle) of a geometry
@@ -43,6 +45,7 @@
 \defgroup is_empty is_empty: detect if a geometry is the empty set
 \defgroup is_simple is_simple: detect if a geometry is simple
 \defgroup is_valid is_valid: detect if a geometry is valid
+\defgroup is_within_distance is_within_distance: detect if two geometries are within a specified distance
 \defgroup iterators iterators: iterators
 \defgroup length length: calculate length of a linear geometry
 \defgroup make make: construct geometries
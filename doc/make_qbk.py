@@ -89,9 +89,11 @@ call_doxygen()
 
 algorithms = ["append", "assign", "make", "clear"
     , "area", "buffer", "centroid", "convert", "correct", "covered_by"
-    , "convex_hull", "crosses", "difference", "disjoint", "distance" 
+    , "convex_hull", "crosses", "difference", "disjoint"
+    , "discrete_frechet_distance", "discrete_hausdorff_distance", "distance"
     , "envelope", "equals", "expand", "for_each", "is_empty"
-    , "is_simple", "is_valid", "intersection", "intersects", "length"
+    , "is_simple", "is_valid", "is_within_distance", "intersection"
+    , "intersects", "length"
     , "num_geometries", "num_interior_rings", "num_points"
     , "num_segments", "overlaps", "perimeter", "relate", "relation"
     , "reverse", "simplify", "sym_difference", "touches"
@@ -124,15 +126,18 @@ strategies = ["distance::pythagoras", "distance::pythagoras_box_box"
     , "distance::projected_point"
     , "within::winding", "within::franklin", "within::crossings_multiply"
     , "area::surveyor", "area::huiller"
-    , "buffer::point_circle", "buffer::point_square"
-    , "buffer::join_round", "buffer::join_miter"
-    , "buffer::end_round", "buffer::end_flat"
+    , "buffer::point_circle", "buffer::point_circle_by_deviation"
+    , "buffer::point_square"
+    , "buffer::join_round", "buffer::join_round_by_deviation"
+    , "buffer::join_miter"
+    , "buffer::end_round", "buffer::end_round_by_deviation"
+    , "buffer::end_flat"
     , "buffer::distance_symmetric", "buffer::distance_asymmetric"
     , "buffer::side_straight"
     , "centroid::bashein_detmer", "centroid::average"
     , "convex_hull::graham_andrew"
     , "simplify::douglas_peucker"
-    , "side::side_by_triangle", "side::side_by_cross_track", "side::spherical_side_formula"
+    , "side::side_by_triangle", "side::side_robust", "side::side_by_cross_track", "side::spherical_side_formula"
     , "transform::inverse_transformer", "transform::map_transformer"
     , "transform::rotate_transformer", "transform::scale_transformer"
     , "transform::translate_transformer", "transform::matrix_transformer"
@@ -0,0 +1,139 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/cascaded_union.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Creates count * count squares of size 10, with a distance of 8 between
+// the origins, such that each square overlaps with its neighbours
+template <typename Polygon, typename Collection>
+void make_squares(Collection& collection, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    // Add them in a non-spatial order
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = ((i * 7) % count) * 8.0;
+            double const y = ((j * 11) % count) * 8.0;
+
+            Polygon poly;
+            bg::append(poly, point_type(x, y));
+            bg::append(poly, point_type(x, y + 10.0));
+            bg::append(poly, point_type(x + 10.0, y + 10.0));
+            bg::append(poly, point_type(x + 10.0, y));
+            bg::append(poly, point_type(x, y));
+            collection.push_back(poly);
+        }
+    }
+}
+
+template <typename MultiPolygon, typename Geometries>
+void test_one(std::string const& caseid, Geometries const& geometries,
+              std::size_t thread_count,
+              std::size_t expected_count, double expected_area)
+{
+    MultiPolygon result;
+    bg::cascaded_union(geometries, result, thread_count);
+
+    BOOST_CHECK_MESSAGE(result.size() == expected_count,
+        caseid << " threads: " << thread_count
+               << " count: " << result.size()
+               << " expected: " << expected_count);
+    BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.0001);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result),
+        caseid << " threads: " << thread_count << " result is not valid");
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        // Grid of 20x20 overlapping squares, forming one square of 162x162
+        std::vector<polygon> polygons;
+        make_squares<polygon>(polygons, 20);
+        double const expected_area = 162.0 * 162.0;
+        test_one<multi_polygon>("grid", polygons, 1, 1, expected_area);
+        test_one<multi_polygon>("grid", polygons, 2, 1, expected_area);
+        test_one<multi_polygon>("grid", polygons, 4, 1, expected_area);
+        test_one<multi_polygon>("grid", polygons, 7, 1, expected_area);
+    }
+
+    {
+        // Overlapping polygons in one (invalid) multi-polygon, and two
+        // separate squares
+        multi_polygon mp;
+        make_squares<polygon>(mp, 3);
+        polygon square;
+        bg::read_wkt("POLYGON((100 100,100 110,110 110,110 100,100 100))", square);
+        mp.push_back(square);
+        bg::read_wkt("POLYGON((200 0,200 10,210 10,210 0,200 0))", square);
+        mp.push_back(square);
+        test_one<multi_polygon>("multi", mp, 1, 3, 26.0 * 26.0 + 200.0);
+        test_one<multi_polygon>("multi", mp, 3, 3, 26.0 * 26.0 + 200.0);
+    }
+
+    {
+        // Range of multi-polygons, the result is a vector of polygons
+        std::vector<multi_polygon> mps(2);
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 18,18 18,18 0,0 0)),((40 0,40 5,45 5,45 0,40 0)))", mps[0]);
+        bg::read_wkt("MULTIPOLYGON(((5 5,5 30,30 30,30 5,5 5),(10 10,20 10,20 20,10 20,10 10)))", mps[1]);
+
+        std::vector<polygon> result;
+        bg::cascaded_union(mps, result);
+        BOOST_CHECK_EQUAL(result.size(), 2u);
+        // Union of 18x18 and 25x25 (overlapping 13x13), minus the
+        // part of the hole not covered by the first (10x10 - 8x8),
+        // and a separate square of 5x5
+        double area = 0.0;
+        for (std::size_t i = 0; i < result.size(); i++)
+        {
+            area += bg::area(result[i]);
+        }
+        BOOST_CHECK_CLOSE(area, 18.0 * 18.0 + 25.0 * 25.0
+                    - 13.0 * 13.0 - (10.0 * 10.0 - 8.0 * 8.0) + 25.0, 0.0001);
+    }
+
+    {
+        // One multi-polygon with overlapping polygons is dissolved as well
+        std::vector<multi_polygon> mps(1);
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((1 1,1 3,3 3,3 1,1 1)))", mps[0]);
+        test_one<multi_polygon>("single", mps, 1, 1, 7.0);
+        test_one<multi_polygon>("single", mps, 4, 1, 7.0);
+    }
+
+    {
+        // Empty input
+        std::vector<polygon> polygons;
+        test_one<multi_polygon>("empty", polygons, 4, 0, 0.0);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/clip_by_grid.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+struct measure_area
+{
+    template <typename Geometry>
+    static inline double apply(Geometry const& geometry)
+    {
+        return bg::area(geometry);
+    }
+};
+
+struct measure_length
+{
+    template <typename Geometry>
+    static inline double apply(Geometry const& geometry)
+    {
+        return bg::length(geometry);
+    }
+};
+
+
+// Verifies that the result for each cell is valid, and the same as the
+// intersection of the geometry with the box of that cell
+template <typename Collection, typename Measure, typename Geometry, typename Box>
+void test_one(std::string const& caseid, std::string const& wkt,
+              Box const& extent, std::size_t columns, std::size_t rows,
+              double expected_total)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::vector<Collection> cells;
+    bg::clip_by_grid(geometry, extent, columns, rows, cells);
+
+    BOOST_CHECK_EQUAL(cells.size(), columns * rows);
+
+    double const width = (bg::get<bg::max_corner, 0>(extent)
+                          - bg::get<bg::min_corner, 0>(extent)) / columns;
+    double const height = (bg::get<bg::max_corner, 1>(extent)
+                           - bg::get<bg::min_corner, 1>(extent)) / rows;
+
+    double total = 0.0;
+    for (std::size_t j = 0; j < rows; j++)
+    {
+        for (std::size_t i = 0; i < columns; i++)
+        {
+            Collection const& cell = cells[j * columns + i];
+
+            Box tile;
+            bg::set<bg::min_corner, 0>(tile, bg::get<bg::min_corner, 0>(extent) + i * width);
+            bg::set<bg::min_corner, 1>(tile, bg::get<bg::min_corner, 1>(extent) + j * height);
+            bg::set<bg::max_corner, 0>(tile, bg::get<bg::min_corner, 0>(extent) + (i + 1) * width);
+            bg::set<bg::max_corner, 1>(tile, bg::get<bg::min_corner, 1>(extent) + (j + 1) * height);
+
+            Collection expected;
+            bg::intersection(geometry, tile, expected);
+
+            for (typename boost::range_iterator<Collection const>::type
+                    it = boost::begin(cell); it != boost::end(cell); ++it)
+            {
+                std::string message;
+                BOOST_CHECK_MESSAGE(bg::is_valid(*it, message),
+                    caseid << " cell " << i << "," << j
+                    << " not valid: " << message << " " << bg::wkt(*it));
+            }
+
+            double const measure = Measure::apply(cell);
+            BOOST_CHECK_MESSAGE(cell.size() == expected.size(),
+                caseid << " cell " << i << "," << j
+                << " count: " << cell.size() << " expected: " << expected.size());
+            BOOST_CHECK_CLOSE(measure, Measure::apply(expected), 0.0001);
+            total += measure;
+        }
+    }
+
+    BOOST_CHECK_CLOSE(total, expected_total, 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    box const extent(P(0, 0), P(10, 10));
+
+    test_one<multi_polygon, measure_area, polygon>("diamond",
+        "POLYGON((0 5,5 10,10 5,5 0,0 5))", extent, 4, 4, 50.0);
+    test_one<multi_polygon, measure_area, polygon>("diamond_3x5",
+        "POLYGON((0 5,5 10,10 5,5 0,0 5))", extent, 3, 5, 50.0);
+    test_one<multi_polygon, measure_area, polygon>("with_hole",
+        "POLYGON((-1 -1,-1 11,11 11,11 -1,-1 -1),(2 2,8 3,8 8,3 7,2 2))", extent, 5, 5,
+        100.0 - 27.0);
+    test_one<multi_polygon, measure_area, multi_polygon>("multi",
+        "MULTIPOLYGON(((1 1,1 4,4 4,4 1,1 1)),((5 5,5 9,12 9,12 5,5 5)))", extent, 3, 3,
+        9.0 + 20.0);
+    test_one<multi_polygon, measure_area, polygon>("outside",
+        "POLYGON((20 20,20 30,30 30,30 20,20 20))", extent, 2, 2, 0.0);
+    test_one<multi_polygon, measure_area, polygon>("one_cell",
+        "POLYGON((0 0,0 4,4 4,4 0,0 0))", extent, 1, 1, 16.0);
+
+    // Concave polygons with reflex vertices and edges on grid lines
+    test_one<multi_polygon, measure_area, polygon>("concave_reflex_on_grid",
+        "POLYGON((1 1,1 3,5 4,1 5,1 9,9 9,9 1,1 1))", extent, 4, 4, 60.0);
+    test_one<multi_polygon, measure_area, polygon>("concave_along_grid",
+        "POLYGON((0 0,0 4,8 4,5 2,5 0,0 0))", extent, 4, 4, 23.0);
+
+    test_one<multi_linestring, measure_length, linestring>("line",
+        "LINESTRING(-1 1,11 1,11 9,1 9,1 3,9 3)", extent, 4, 3, 10.0 + 9.0 + 6.0 + 8.0);
+    test_one<multi_linestring, measure_length, multi_linestring>("multi_line",
+        "MULTILINESTRING((0.5 0.5,9.5 0.5),(0.5 2,0.5 8))", extent, 3, 3, 9.0 + 6.0);
+
+    // Lines on a grid line are part of the cells at both sides
+    test_one<multi_linestring, measure_length, linestring>("line_on_grid_line",
+        "LINESTRING(1 0.2,1 0.8)", box(P(0, 0), P(2, 1)), 2, 1, 2.0 * 0.6);
+    test_one<multi_linestring, measure_length, linestring>("line_along_grid_line",
+        "LINESTRING(2 1,5 1,5 9,8 9)", extent, 2, 2, 3.0 + 8.0 + 8.0 + 3.0);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/coverage_union.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Creates a coverage of count * count unit squares, skipping the cells
+// for which the predicate returns true
+template <typename Polygon, typename Collection, typename Skip>
+void make_grid(Collection& collection, int count, Skip const& skip,
+               double offset = 0.0)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            if (skip(i, j))
+            {
+                continue;
+            }
+
+            double const x = offset + i;
+            double const y = j;
+
+            Polygon poly;
+            bg::append(poly, point_type(x, y));
+            bg::append(poly, point_type(x, y + 1.0));
+            bg::append(poly, point_type(x + 1.0, y + 1.0));
+            bg::append(poly, point_type(x + 1.0, y));
+            bg::append(poly, point_type(x, y));
+            bg::correct(poly);
+            collection.push_back(poly);
+        }
+    }
+}
+
+struct skip_none
+{
+    inline bool operator()(int, int) const { return false; }
+};
+
+struct skip_center
+{
+    inline bool operator()(int i, int j) const { return i == 2 && j == 2; }
+};
+
+struct skip_odd
+{
+    inline bool operator()(int i, int j) const { return (i + j) % 2 == 1; }
+};
+
+template <typename MultiPolygon, typename Geometries>
+void test_one(std::string const& caseid, Geometries const& geometries,
+              std::size_t expected_count, std::size_t expected_holes,
+              double expected_area, bool compare_with_general = true)
+{
+    MultiPolygon result;
+    bg::coverage_union(geometries, result);
+
+    BOOST_CHECK_MESSAGE(result.size() == expected_count,
+        caseid << " count: " << result.size()
+               << " expected: " << expected_count);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(result), expected_holes);
+    BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.0001);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result),
+        caseid << " result is not valid: " << bg::wkt(result));
+
+    if (! compare_with_general)
+    {
+        return;
+    }
+
+    // The union is the same as the result of the general overlay
+    MultiPolygon general;
+    bg::cascaded_union(geometries, general);
+    BOOST_CHECK_EQUAL(result.size(), general.size());
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(general), 0.0001);
+}
+
+template <typename P, bool ClockWise, bool Closed>
+void test_all()
+{
+    typedef bg::model::polygon<P, ClockWise, Closed> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        std::vector<polygon> polygons;
+        make_grid<polygon>(polygons, 10, skip_none());
+        test_one<multi_polygon>("grid", polygons, 1, 0, 100.0);
+    }
+
+    {
+        // The center cell is missing, forming a hole
+        std::vector<polygon> polygons;
+        make_grid<polygon>(polygons, 5, skip_center());
+        test_one<multi_polygon>("grid_hole", polygons, 1, 1, 24.0);
+    }
+
+    {
+        // Two separate grids, in one (invalid) multi-polygon, which is
+        // passed as is by cascaded_union
+        multi_polygon mp;
+        make_grid<polygon>(mp, 4, skip_none());
+        make_grid<polygon>(mp, 4, skip_none(), 10.0);
+        std::vector<multi_polygon> mps(1, mp);
+        test_one<multi_polygon>("two_grids", mps, 2, 0, 32.0, false);
+    }
+
+    {
+        // Checkerboard: cells only touch each other at their corners
+        std::vector<polygon> polygons;
+        make_grid<polygon>(polygons, 4, skip_odd());
+        test_one<multi_polygon>("checkerboard", polygons, 8, 0, 8.0);
+    }
+
+    {
+        // The lower rectangle is not split at the vertex of the upper
+        // squares, they do not share an edge
+        std::vector<polygon> polygons(3);
+        bg::read_wkt("POLYGON((0 0,0 1,2 1,2 0,0 0))", polygons[0]);
+        bg::read_wkt("POLYGON((0 1,0 2,1 2,1 1,0 1))", polygons[1]);
+        bg::read_wkt("POLYGON((1 1,1 2,2 2,2 1,1 1))", polygons[2]);
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::correct(polygons[i]);
+        }
+        test_one<multi_polygon>("not_split", polygons, 1, 0, 4.0);
+
+        // Adding a polygon sharing edges with all of them, such that they
+        // are all in one component
+        polygons.resize(4);
+        bg::read_wkt("POLYGON((-1 0,-1 2,0 2,0 1,0 0,-1 0))", polygons[3]);
+        bg::correct(polygons[3]);
+        test_one<multi_polygon>("not_split_component", polygons, 1, 0, 6.0);
+    }
+
+    {
+        // Overlapping polygons, sharing an edge as well
+        std::vector<polygon> polygons(3);
+        bg::read_wkt("POLYGON((0 0,0 2,2 2,2 0,0 0))", polygons[0]);
+        bg::read_wkt("POLYGON((2 0,2 2,4 2,4 0,2 0))", polygons[1]);
+        bg::read_wkt("POLYGON((1 1,1 3,3 3,3 1,1 1))", polygons[2]);
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::correct(polygons[i]);
+        }
+        test_one<multi_polygon>("overlapping", polygons, 1, 0, 10.0);
+    }
+
+    {
+        // The upper polygon shares edges with both lower squares (after
+        // splitting the edge of the right square at its vertex), and
+        // overlaps the right square
+        std::vector<polygon> polygons(3);
+        bg::read_wkt("POLYGON((0 0,0 2,2 2,2 0,0 0))", polygons[0]);
+        bg::read_wkt("POLYGON((2 0,2 2,4 2,4 0,2 0))", polygons[1]);
+        bg::read_wkt("POLYGON((0 2,0 4,3 4,3 1,2.5 1,2.5 2,2 2,0 2))",
+                     polygons[2]);
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::correct(polygons[i]);
+        }
+        test_one<multi_polygon>("overlapping_component", polygons, 1, 0, 14.0);
+    }
+
+    {
+        // The center cell occurs twice, all its edges are shared with its
+        // neighbours
+        std::vector<polygon> polygons;
+        make_grid<polygon>(polygons, 3, skip_none());
+        polygons.push_back(polygons[4]);
+        test_one<multi_polygon>("duplicate", polygons, 1, 0, 9.0);
+    }
+
+    {
+        // Overlapping polygons, sharing a part of their boundary in the
+        // same direction, and having the same hole
+        std::vector<polygon> polygons(2);
+        bg::read_wkt("POLYGON((0 0,0 2,2 2,2 0,0 0),(0.5 0.5,1 0.5,1 1,0.5 1,0.5 0.5))",
+                     polygons[0]);
+        bg::read_wkt("POLYGON((0 0,0 1.5,2 1.5,2 0,0 0),(0.5 0.5,1 0.5,1 1,0.5 1,0.5 0.5))",
+                     polygons[1]);
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::correct(polygons[i]);
+        }
+        test_one<multi_polygon>("same_hole", polygons, 1, 1, 3.75);
+    }
+
+    {
+        std::vector<polygon> polygons;
+        test_one<multi_polygon>("empty", polygons, 0, 0, 0.0);
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point;
+    test_all<point, true, true>();
+    test_all<point, false, false>();
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/incremental_buffer.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/sym_difference.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// A track turning left and right, crossing itself now and then
+template <typename Linestring>
+Linestring make_track(int count)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    Linestring result;
+    double x = 0.0;
+    double y = 0.0;
+    double angle = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        result.push_back(point_type(x, y));
+        angle += 0.7 * std::sin(i * 0.3);
+        x += std::cos(angle);
+        y += std::sin(angle);
+    }
+    return result;
+}
+
+// A track sweeping back and forth, crossing itself many times and
+// enclosing many holes
+template <typename Linestring>
+Linestring make_crossing_track(int count)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    Linestring result;
+    for (int i = 0; i < count; i++)
+    {
+        result.push_back(point_type(20.0 * std::sin(i * 0.071) + i * 0.2,
+                                    20.0 * std::sin(i * 0.11)));
+    }
+    return result;
+}
+
+template
+<
+    typename Linestring,
+    typename MultiPolygon,
+    typename JoinStrategy,
+    typename EndStrategy
+>
+void test_one(std::string const& caseid, Linestring const& track,
+              double distance,
+              JoinStrategy const& join_strategy,
+              EndStrategy const& end_strategy,
+              std::size_t tail_size, double tolerance,
+              int compare_every = 25)
+{
+    typedef bg::strategy::buffer::distance_symmetric<double> distance_type;
+    typedef bg::strategy::buffer::side_straight side_type;
+    typedef bg::strategy::buffer::point_circle point_type;
+
+    distance_type const distance_strategy(distance);
+
+    bg::incremental_buffer
+        <
+            Linestring, MultiPolygon,
+            distance_type, side_type, JoinStrategy, EndStrategy, point_type
+        > incremental(distance_strategy, side_type(), join_strategy,
+                      end_strategy, point_type(16), tail_size);
+
+    Linestring so_far;
+    for (std::size_t i = 0; i < track.size(); i++)
+    {
+        incremental.append(track[i]);
+        so_far.push_back(track[i]);
+
+        // Compare now and then, and at the end
+        if (i % compare_every != 0 && i + 1 != track.size())
+        {
+            continue;
+        }
+
+        MultiPolygon expected, result;
+        bg::buffer(so_far, expected, distance_strategy, side_type(),
+                   join_strategy, end_strategy, point_type(16));
+        incremental.get(result);
+
+        BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+            caseid << " points: " << i + 1
+                   << " count: " << result.size()
+                   << " expected: " << expected.size());
+        BOOST_CHECK_EQUAL(bg::num_interior_rings(result),
+                          bg::num_interior_rings(expected));
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), tolerance);
+
+        // Not only the areas, the shapes should be (nearly) the same
+        MultiPolygon difference;
+        bg::sym_difference(result, expected, difference);
+        BOOST_CHECK_MESSAGE(bg::area(difference)
+                                <= bg::area(expected) * tolerance / 100.0,
+            caseid << " points: " << i + 1
+                   << " difference: " << bg::area(difference));
+        BOOST_CHECK_MESSAGE(bg::is_valid(result),
+            caseid << " points: " << i + 1 << " not valid");
+    }
+
+    BOOST_CHECK_EQUAL(incremental.size(), track.size());
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::join_round join_round(16);
+    bg::strategy::buffer::join_miter join_miter;
+    bg::strategy::buffer::end_round end_round(16);
+    bg::strategy::buffer::end_flat end_flat;
+
+    linestring const track = make_track<linestring>(200);
+
+    // Round ends at the shared points are approximated differently from the
+    // round joins there, and can stick out a little
+    test_one<linestring, multi_polygon>("round", track, 1.5,
+                                        join_round, end_round, 16, 0.1);
+    test_one<linestring, multi_polygon>("round_small_tail", track, 1.5,
+                                        join_round, end_round, 3, 0.1);
+    test_one<linestring, multi_polygon>("miter_flat", track, 0.8,
+                                        join_miter, end_flat, 10, 0.001);
+
+    // Settled holes far from the tail are not passed to the overlay
+    linestring const crossing = make_crossing_track<linestring>(1000);
+    test_one<linestring, multi_polygon>("crossing_round", crossing, 1.0,
+                                        join_round, end_round, 8, 0.1, 100);
+    test_one<linestring, multi_polygon>("crossing_miter", crossing, 0.6,
+                                        join_miter, end_flat, 8, 0.001, 100);
+
+    {
+        // A single point, and duplicate points, are buffered by the point
+        // strategy
+        bg::strategy::buffer::distance_symmetric<double> distance(1.0);
+        bg::incremental_buffer
+            <
+                linestring, multi_polygon,
+                bg::strategy::buffer::distance_symmetric<double>,
+                bg::strategy::buffer::side_straight,
+                bg::strategy::buffer::join_round,
+                bg::strategy::buffer::end_round,
+                bg::strategy::buffer::point_circle
+            > incremental(distance, bg::strategy::buffer::side_straight(),
+                join_round, end_round, bg::strategy::buffer::point_circle(4));
+
+        multi_polygon result;
+        incremental.get(result);
+        BOOST_CHECK(result.empty());
+
+        incremental.append(P(0, 0));
+        incremental.append(P(0, 0));
+        incremental.get(result);
+        BOOST_CHECK_EQUAL(incremental.size(), 1u);
+        BOOST_CHECK_CLOSE(bg::area(result), 2.0, 0.001);
+
+        incremental.clear();
+        incremental.get(result);
+        BOOST_CHECK(result.empty());
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/parallel_buffer.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Creates a network of short road segments along a grid, in a non
+// spatial order. Segments meet at the grid nodes.
+template <typename Linestring, typename Collection>
+void make_roads(Collection& collection, int count)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = ((i * 7) % count) * 10.0;
+            double const y = ((j * 11) % count) * 10.0;
+
+            Linestring horizontal, vertical;
+            horizontal.push_back(point_type(x, y));
+            horizontal.push_back(point_type(x + 10.0, y + 1.0));
+            vertical.push_back(point_type(x, y));
+            vertical.push_back(point_type(x - 1.0, y + 10.0));
+            collection.push_back(horizontal);
+            collection.push_back(vertical);
+        }
+    }
+}
+
+template <typename MultiPolygon, typename Geometry>
+void test_one(std::string const& caseid, Geometry const& geometry,
+              double distance)
+{
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy(16);
+    bg::strategy::buffer::end_round end_strategy(16);
+    bg::strategy::buffer::point_circle point_strategy(16);
+
+    MultiPolygon serial;
+    bg::buffer(geometry, serial, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+    double const expected_area = bg::area(serial);
+
+    for (std::size_t thread_count = 1; thread_count <= 4; thread_count++)
+    {
+        MultiPolygon parallel;
+        bg::buffer(geometry, parallel, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy,
+                   thread_count);
+
+        BOOST_CHECK_MESSAGE(parallel.size() == serial.size(),
+            caseid << " threads: " << thread_count
+                   << " count: " << parallel.size()
+                   << " expected: " << serial.size());
+        BOOST_CHECK_EQUAL(bg::num_interior_rings(parallel),
+                          bg::num_interior_rings(serial));
+        BOOST_CHECK_CLOSE(bg::area(parallel), expected_area, 0.001);
+        BOOST_CHECK_MESSAGE(bg::is_valid(parallel),
+            caseid << " threads: " << thread_count << " not valid");
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        // A grid of road segments, enclosing holes
+        multi_linestring roads;
+        make_roads<linestring>(roads, 8);
+        test_one<multi_polygon>("roads", roads, 2.0);
+    }
+
+    {
+        multi_point points;
+        for (int i = 0; i < 50; i++)
+        {
+            points.push_back(P((i * 17) % 50, (i * 13) % 7));
+        }
+        test_one<multi_polygon>("points", points, 1.5);
+    }
+
+    {
+        multi_polygon mp;
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4)),"
+                     "((12 0,12 10,20 10,20 0,12 0)),((30 0,30 5,35 5,35 0,30 0)))", mp);
+        test_one<multi_polygon>("polygons", mp, 1.5);
+        test_one<multi_polygon>("polygons_deflate", mp, -0.5);
+    }
+
+    {
+        // A range of features, buffered into one multi-polygon
+        std::vector<linestring> features;
+        make_roads<linestring>(features, 6);
+
+        multi_linestring roads;
+        roads.assign(features.begin(), features.end());
+        multi_polygon expected;
+        bg::strategy::buffer::distance_symmetric<double> distance_strategy(2.0);
+        bg::strategy::buffer::side_straight side_strategy;
+        bg::strategy::buffer::join_round join_strategy(16);
+        bg::strategy::buffer::end_round end_strategy(16);
+        bg::strategy::buffer::point_circle point_strategy(16);
+        bg::buffer(roads, expected, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy);
+
+        multi_polygon result;
+        bg::buffer_all(features, result, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy, 3);
+        BOOST_CHECK_EQUAL(result.size(), expected.size());
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.001);
+
+        // Empty input
+        features.clear();
+        bg::buffer_all(features, result, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy, 3);
+        BOOST_CHECK(result.empty());
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
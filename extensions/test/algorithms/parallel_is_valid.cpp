@@ -0,0 +1,162 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/algorithms/parallel_is_valid.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Creates squares of size 10 in a checkerboard pattern of count * count
+// cells, touching their neighbours at the corners if the distance is 10,
+// separated if it is larger, or overlapping if it is smaller
+template <typename MultiPolygon>
+void make_squares(MultiPolygon& multi_polygon, int count, double distance)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i % 2; j < count; j += 2)
+        {
+            double const x = i * distance;
+            double const y = j * distance;
+
+            polygon_type poly;
+            bg::append(poly, point_type(x, y));
+            bg::append(poly, point_type(x, y + 10.0));
+            bg::append(poly, point_type(x + 10.0, y + 10.0));
+            bg::append(poly, point_type(x + 10.0, y));
+            bg::append(poly, point_type(x, y));
+            multi_polygon.push_back(poly);
+        }
+    }
+}
+
+// Verifies that the parallel validation gives the same result as
+// the sequential validation
+template <typename Geometry>
+void test_geometry(std::string const& caseid, Geometry const& geometry,
+                   bg::validity_failure_type expected)
+{
+    bg::validity_failure_type sequential = bg::no_failure;
+    bg::is_valid(geometry, sequential);
+    BOOST_CHECK_MESSAGE(sequential == expected,
+        caseid << " sequential: " << sequential << " expected: " << expected);
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 8 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        bg::validity_failure_type failure = bg::no_failure;
+        bool const valid = bg::is_valid(geometry, failure, thread_counts[i]);
+
+        BOOST_CHECK_MESSAGE(failure == expected && valid == (expected == bg::no_failure),
+            caseid << " threads: " << thread_counts[i]
+                   << " failure: " << failure << " expected: " << expected);
+    }
+}
+
+template <typename Geometry>
+void test_one(std::string const& caseid, std::string const& wkt,
+              bg::validity_failure_type expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    test_geometry(caseid, geometry, expected);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    {
+        multi_polygon separated, touching, overlapping;
+        make_squares(separated, 10, 12.0);
+        make_squares(touching, 10, 10.0);
+        make_squares(overlapping, 10, 4.0);
+        test_geometry("separated", separated, bg::no_failure);
+        test_geometry("touching", touching, bg::no_failure);
+        test_geometry("overlapping", overlapping, bg::failure_self_intersections);
+    }
+
+    test_one<multi_polygon>("nested",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((2 2,2 8,8 8,8 2,2 2)))",
+        bg::failure_intersecting_interiors);
+    test_one<multi_polygon>("in_hole",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),((3 3,3 7,7 7,7 3,3 3)))",
+        bg::no_failure);
+    test_one<multi_polygon>("touching_hole",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),((2 2,3 5,5 3,2 2)))",
+        bg::no_failure);
+    test_one<multi_polygon>("invalid_component",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 0,30 4,20 0)))",
+        bg::failure_self_intersections);
+    test_one<multi_polygon>("wrong_orientation",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,30 0,30 10,20 10,20 0)))",
+        bg::failure_wrong_orientation);
+    test_one<multi_polygon>("empty", "MULTIPOLYGON()", bg::no_failure);
+
+    test_one<multi_linestring>("lines",
+        "MULTILINESTRING((0 0,10 10),(0 10,10 0),(5 5,6 6,5 5))",
+        bg::no_failure);
+    test_one<multi_linestring>("one_point_line",
+        "MULTILINESTRING((0 0,10 10),(1 1))",
+        bg::failure_few_points);
+
+    test_one<polygon>("polygon", "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+        bg::no_failure);
+
+    {
+        // Batch validation of a range
+        std::vector<polygon> polygons(4);
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", polygons[0]);
+        bg::read_wkt("POLYGON((0 0,0 10,10 0,10 4,0 0))", polygons[1]);
+        bg::read_wkt("POLYGON((0 0,10 0,10 10,0 10,0 0))", polygons[2]);
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", polygons[3]);
+
+        for (std::size_t threads = 1; threads <= 5; threads++)
+        {
+            std::vector<bg::validity_failure_type> failures;
+            BOOST_CHECK(! bg::is_valid_each(polygons, failures, threads));
+            BOOST_CHECK_EQUAL(failures.size(), 4u);
+            if (failures.size() == 4u)
+            {
+                BOOST_CHECK(failures[0] == bg::no_failure);
+                BOOST_CHECK(failures[1] == bg::failure_self_intersections);
+                BOOST_CHECK(failures[2] == bg::failure_wrong_orientation);
+                BOOST_CHECK(failures[3] == bg::no_failure);
+            }
+        }
+
+        std::vector<bg::validity_failure_type> failures;
+        std::vector<polygon> valid_polygons(1, polygons[3]);
+        BOOST_CHECK(bg::is_valid_each(valid_polygons, failures, 2));
+        BOOST_CHECK(bg::is_valid_each(std::vector<polygon>(), failures, 2));
+        BOOST_CHECK(failures.empty());
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,355 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CONVEX_INSET_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CONVEX_INSET_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/is_convex.hpp>
+
+#include <boost/geometry/strategies/buffer.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+// Deflates a convex ring (negative buffer distance) without building pieces,
+// turns and traversals. For a convex ring the deflated ring is the
+// intersection of the half-planes at the inner side of the offsetted
+// segments, independent on the join strategy (all corners are concave on
+// the deflated side). The ring is clipped by these half-planes, one by one.
+template <typename RingOutput>
+struct buffer_convex_inset
+{
+    typedef typename point_type<RingOutput>::type output_point_type;
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<output_point_type>::type,
+            double
+        >::type promoted_type;
+
+    // Returns the cross product of (p2 - p1) and (p - p1), positive if p is
+    // at the left side of p1-p2
+    static inline promoted_type side_value(output_point_type const& p1,
+                output_point_type const& p2, output_point_type const& p)
+    {
+        promoted_type const dx = get<0>(p2) - get<0>(p1);
+        promoted_type const dy = get<1>(p2) - get<1>(p1);
+        promoted_type const px = get<0>(p) - get<0>(p1);
+        promoted_type const py = get<1>(p) - get<1>(p1);
+        return dx * py - dy * px;
+    }
+
+    // Clips the counter clockwise, open, convex polygon by the half-plane
+    // at the left side of p1-p2 (Sutherland-Hodgman, for one edge)
+    static inline void clip(std::vector<output_point_type> const& input,
+                output_point_type const& p1, output_point_type const& p2,
+                std::vector<output_point_type>& output)
+    {
+        output.clear();
+        std::size_t const n = input.size();
+        if (n == 0)
+        {
+            return;
+        }
+
+        output_point_type const* previous = &input[n - 1];
+        promoted_type previous_side = side_value(p1, p2, *previous);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            output_point_type const& current = input[i];
+            promoted_type const current_side = side_value(p1, p2, current);
+
+            if ((previous_side < 0 && current_side > 0)
+                || (previous_side > 0 && current_side < 0))
+            {
+                // The edge crosses the line, add the intersection point
+                promoted_type const fraction
+                    = previous_side / (previous_side - current_side);
+                output_point_type ip;
+                set<0>(ip, get<0>(*previous)
+                    + fraction * (get<0>(current) - get<0>(*previous)));
+                set<1>(ip, get<1>(*previous)
+                    + fraction * (get<1>(current) - get<1>(*previous)));
+                output.push_back(ip);
+            }
+            if (current_side >= 0)
+            {
+                output.push_back(current);
+            }
+
+            previous = &current;
+            previous_side = current_side;
+        }
+    }
+
+    // Returns true if p is (nearly) on the line through p1-p2, or if p1 and
+    // p2 are equal. The tolerance is a distance
+    static inline bool is_negligible(output_point_type const& p1,
+                output_point_type const& p2, output_point_type const& p,
+                promoted_type const& tolerance)
+    {
+        promoted_type const dx = get<0>(p2) - get<0>(p1);
+        promoted_type const dy = get<1>(p2) - get<1>(p1);
+        promoted_type const side = side_value(p1, p2, p);
+        return side * side <= tolerance * tolerance * (dx * dx + dy * dy);
+    }
+
+    // Removes duplicate and (nearly) collinear points from the open ring.
+    // Slivers left by clipping collapse to fewer than three points.
+    static inline void remove_collinear(std::vector<output_point_type>& polygon,
+                promoted_type const& tolerance)
+    {
+        std::vector<output_point_type> cleaned;
+        cleaned.reserve(polygon.size());
+        for (std::size_t i = 0; i < polygon.size(); i++)
+        {
+            cleaned.push_back(polygon[i]);
+            while (cleaned.size() >= 3
+                && is_negligible(cleaned[cleaned.size() - 3],
+                        cleaned.back(), cleaned[cleaned.size() - 2],
+                        tolerance))
+            {
+                cleaned.erase(cleaned.end() - 2);
+            }
+        }
+
+        // Check the points around the closing point
+        bool changed = true;
+        while (changed && cleaned.size() >= 3)
+        {
+            changed = false;
+            std::size_t const n = cleaned.size();
+            if (is_negligible(cleaned[n - 2], cleaned[0], cleaned[n - 1],
+                              tolerance))
+            {
+                cleaned.pop_back();
+                changed = true;
+            }
+            else if (is_negligible(cleaned[n - 1], cleaned[1], cleaned[0],
+                                   tolerance))
+            {
+                cleaned.erase(cleaned.begin());
+                changed = true;
+            }
+        }
+
+        polygon.swap(cleaned);
+    }
+
+    // Returns false if the ring cannot be deflated by this method.
+    // Then the generic buffer algorithm should be used.
+    template
+    <
+        typename RingInput,
+        typename DistanceStrategy,
+        typename SideStrategy
+    >
+    static inline bool apply(RingInput const& ring,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                RingOutput& ring_out, bool& empty)
+    {
+        empty = true;
+
+        if (! distance_strategy.negative() || ! geometry::is_convex(ring))
+        {
+            return false;
+        }
+
+        // Collect the distinct points, counter clockwise and open
+        typedef detail::normalized_view<RingInput const> view_type;
+        view_type view(ring);
+
+        std::vector<output_point_type> polygon;
+        for (typename boost::range_reverse_iterator<view_type const>::type
+                it = boost::rbegin(view); it != boost::rend(view); ++it)
+        {
+            output_point_type point;
+            geometry::detail::conversion::convert_point_to_point(*it, point);
+            if (polygon.empty()
+                || ! equals::equals_point_point(polygon.back(), point))
+            {
+                polygon.push_back(point);
+            }
+        }
+        while (polygon.size() > 1
+            && equals::equals_point_point(polygon.front(), polygon.back()))
+        {
+            polygon.pop_back();
+        }
+
+        std::size_t const n = polygon.size();
+        if (n < 3)
+        {
+            // Degenerate, handled by the generic algorithm
+            return false;
+        }
+
+        // The ring should be counter clockwise, not collinear, and not
+        // winding more than once (then the x-direction of its edges changes
+        // more than twice)
+        promoted_type twice_area = 0;
+        int previous_direction = 0;
+        int first_direction = 0;
+        std::size_t direction_changes = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            output_point_type const& p = polygon[i];
+            output_point_type const& q = polygon[(i + 1) % n];
+            twice_area += promoted_type(get<0>(p)) * get<1>(q)
+                        - promoted_type(get<0>(q)) * get<1>(p);
+
+            int const direction = get<0>(q) > get<0>(p) ? 1
+                                : get<0>(q) < get<0>(p) ? -1 : 0;
+            if (direction != 0)
+            {
+                if (first_direction == 0)
+                {
+                    first_direction = direction;
+                }
+                else if (direction != previous_direction)
+                {
+                    direction_changes++;
+                }
+                previous_direction = direction;
+            }
+        }
+        if (previous_direction != first_direction)
+        {
+            direction_changes++;
+        }
+        if (! (twice_area > 0) || direction_changes > 2)
+        {
+            return false;
+        }
+
+        // The offsetted segments, at the inner side
+        std::vector<output_point_type> offsetted;
+        offsetted.reserve(2 * n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::vector<output_point_type> generated_side;
+            strategy::buffer::result_code const code
+                = side_strategy.apply(polygon[i], polygon[(i + 1) % n],
+                    strategy::buffer::buffer_side_right,
+                    distance_strategy, generated_side);
+            if (code != strategy::buffer::result_normal
+                || generated_side.size() != 2)
+            {
+                return false;
+            }
+            offsetted.push_back(generated_side.front());
+            offsetted.push_back(generated_side.back());
+        }
+
+        // Points closer than this to the line through their neighbours are
+        // considered as collinear. This corresponds to the precision of the
+        // generic algorithm, which rescales the envelope to integer
+        // coordinates in a range of 1e7, such that both discard slivers
+        promoted_type min_x = get<0>(polygon[0]), max_x = min_x;
+        promoted_type min_y = get<1>(polygon[0]), max_y = min_y;
+        for (std::size_t i = 1; i < n; i++)
+        {
+            promoted_type const x = get<0>(polygon[i]);
+            promoted_type const y = get<1>(polygon[i]);
+            min_x = (std::min)(min_x, x);
+            max_x = (std::max)(max_x, x);
+            min_y = (std::min)(min_y, y);
+            max_y = (std::max)(max_y, y);
+        }
+        promoted_type const tolerance
+            = (std::max)(max_x - min_x, max_y - min_y) / 10000000.0;
+
+        std::vector<output_point_type> clipped;
+        for (std::size_t i = 0; i < n && ! polygon.empty(); i++)
+        {
+            clip(polygon, offsetted[2 * i], offsetted[2 * i + 1], clipped);
+            polygon.swap(clipped);
+        }
+
+        remove_collinear(polygon, tolerance);
+        if (polygon.size() < 3)
+        {
+            // Deflated completely
+            return true;
+        }
+
+        promoted_type twice_area_out = 0;
+        for (std::size_t i = 0; i < polygon.size(); i++)
+        {
+            output_point_type const& p = polygon[i];
+            output_point_type const& q = polygon[(i + 1) % polygon.size()];
+            twice_area_out += promoted_type(get<0>(p)) * get<1>(q)
+                        - promoted_type(get<0>(q)) * get<1>(p);
+        }
+        if (! (twice_area_out > 0))
+        {
+            // Deflated to a sliver without area
+            return true;
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(
+                geometry::point_order<RingOutput>::value == clockwise))
+        {
+            for (typename std::vector<output_point_type>::const_reverse_iterator
+                    it = polygon.rbegin(); it != polygon.rend(); ++it)
+            {
+                range::push_back(ring_out, *it);
+            }
+        }
+        else
+        {
+            for (typename std::vector<output_point_type>::const_iterator
+                    it = polygon.begin(); it != polygon.end(); ++it)
+            {
+                range::push_back(ring_out, *it);
+            }
+        }
+        if (BOOST_GEOMETRY_CONDITION(
+                geometry::closure<RingOutput>::value == closed))
+        {
+            range::push_back(ring_out, output_point_type(range::front(ring_out)));
+        }
+
+        empty = false;
+        return true;
+    }
+};
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CONVEX_INSET_HPP
@@ -27,6 +27,7 @@
 
 #include <boost/geometry/strategies/buffer.hpp>
 #include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_convex_inset.hpp>
 #include <boost/geometry/algorithms/detail/buffer/buffered_piece_collection.hpp>
 #include <boost/geometry/algorithms/detail/buffer/line_line_intersection.hpp>
 #include <boost/geometry/algorithms/detail/buffer/parallel_continue.hpp>
@@ -397,6 +398,91 @@ inline void buffer_point(Point const& point, Collection& collection,
     collection.finish_ring(strategy::buffer::result_normal);
 }
 
+// Deflates convex rings and polygons without interior rings directly.
+// Returns false if the geometry is not handled and should be buffered
+// by the generic algorithm.
+template <typename Tag>
+struct convex_inset
+{
+    template
+    <
+        typename GeometryOutput,
+        typename GeometryInput,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy
+    >
+    static inline bool apply(GeometryInput const& , OutputIterator ,
+            DistanceStrategy const& , SideStrategy const& )
+    {
+        return false;
+    }
+};
+
+template <>
+struct convex_inset<ring_tag>
+{
+    template
+    <
+        typename GeometryOutput,
+        typename RingInput,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy
+    >
+    static inline bool apply(RingInput const& ring, OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy)
+    {
+        if (! distance_strategy.negative())
+        {
+            return false;
+        }
+
+        typedef typename geometry::ring_type<GeometryOutput>::type ring_type;
+
+        // Simplify as the generic algorithm does
+        RingInput simplified;
+        detail::buffer::simplify_input(ring, distance_strategy, simplified);
+
+        GeometryOutput polygon;
+        bool empty = true;
+        if (! buffer_convex_inset<ring_type>::apply(simplified,
+                    distance_strategy, side_strategy,
+                    geometry::exterior_ring(polygon), empty))
+        {
+            return false;
+        }
+        if (! empty)
+        {
+            *out++ = polygon;
+        }
+        return true;
+    }
+};
+
+template <>
+struct convex_inset<polygon_tag>
+{
+    template
+    <
+        typename GeometryOutput,
+        typename PolygonInput,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy
+    >
+    static inline bool apply(PolygonInput const& polygon, OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy)
+    {
+        return geometry::num_interior_rings(polygon) == 0
+            && convex_inset<ring_tag>::apply<GeometryOutput>(
+                    geometry::exterior_ring(polygon), out,
+                    distance_strategy, side_strategy);
+    }
+};
+
 
 }} // namespace detail::buffer
 #endif // DOXYGEN_NO_DETAIL
@@ -971,6 +1057,16 @@ inline void buffer_inserter(GeometryInput const& geometry_input, OutputIterator
         PointStrategy const& point_strategy,
         RobustPolicy const& robust_policy)
 {
+    // Convex polygons are deflated without pieces, turns and traversal
+    if (detail::buffer::convex_inset
+            <
+                typename tag<GeometryInput>::type
+            >::template apply<GeometryOutput>(geometry_input, out,
+                distance_strategy, side_strategy))
+    {
+        return;
+    }
+
     detail::buffer::visit_pieces_default_policy visitor;
     buffer_inserter<GeometryOutput>(geometry_input, out,
         distance_strategy, side_strategy, join_strategy,
@@ -9,7 +9,9 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_POLICIES_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_POLICIES_HPP
 
-#if ! defined(BOOST_GEOMETRY_NO_ROBUSTNESS)
+// Side of intersection needs integer (rescaled) coordinates, which are
+// not used with BOOST_GEOMETRY_SIDE_ROBUST
+#if ! defined(BOOST_GEOMETRY_NO_ROBUSTNESS) && ! defined(BOOST_GEOMETRY_SIDE_ROBUST)
 #  define BOOST_GEOMETRY_BUFFER_USE_SIDE_OF_INTERSECTION
 #endif
 
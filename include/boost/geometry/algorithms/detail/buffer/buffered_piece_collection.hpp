@@ -16,6 +16,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range.hpp>
@@ -45,6 +47,7 @@
 #include <boost/geometry/algorithms/detail/overlay/assign_parents.hpp>
 #include <boost/geometry/algorithms/detail/overlay/enrichment_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/enrich_intersection_points.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
 #include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
@@ -54,6 +57,8 @@
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <boost/geometry/util/range.hpp>
 
 
@@ -279,6 +284,16 @@ struct buffered_piece_collection
 
     typedef std::vector<piece> piece_vector_type;
 
+    // Packed rtree over the robust envelopes of the pieces, built after the
+    // turns are inserted into the pieces (which enlarges the envelopes).
+    // It is used to find the pieces which can contain a turn.
+    typedef std::pair<robust_box_type, std::size_t> piece_box_type;
+    typedef geometry::index::rtree
+        <
+            piece_box_type,
+            geometry::index::rstar<16>
+        > piece_rtree_type;
+
     piece_vector_type m_pieces;
     turn_vector_type m_turns;
     signed_size_type m_first_piece_index;
@@ -750,6 +765,30 @@ struct buffered_piece_collection
         }
     }
 
+    inline void build_piece_rtree(piece_rtree_type& piece_rtree) const
+    {
+        std::vector<piece_box_type> boxes;
+        boxes.reserve(m_pieces.size());
+        for (std::size_t i = 0; i < m_pieces.size(); i++)
+        {
+            piece const& pc = m_pieces[i];
+
+            // Turns cannot be inside a flat end (though they can be on
+            // border), neither we need to check if they are inside concave
+            // helper pieces. Pieces without offsetted points are empty.
+            if (pc.offsetted_count > 0
+                && pc.type != strategy::buffer::buffered_flat_end
+                && pc.type != strategy::buffer::buffered_concave)
+            {
+                boxes.push_back(piece_box_type(pc.robust_envelope, i));
+            }
+        }
+
+        // Construction from a range uses the packing algorithm
+        piece_rtree_type rtree(boxes.begin(), boxes.end());
+        piece_rtree.swap(rtree);
+    }
+
     inline void get_turns()
     {
         for(typename boost::range_iterator<sections_type>::type it
@@ -787,19 +826,29 @@ struct buffered_piece_collection
         prepare_buffered_point_pieces();
 
         {
-            // Check if it is inside any of the pieces
+            // Check if it is inside any of the pieces. The pieces are
+            // queried lazily, the query stops as soon as the turn is
+            // found to be inside one of them.
+            piece_rtree_type piece_rtree;
+            build_piece_rtree(piece_rtree);
+
             turn_in_piece_visitor
                 <
                     turn_vector_type, piece_vector_type
                 > visitor(m_turns, m_pieces);
 
-            geometry::partition
-                <
-                    robust_box_type,
-                    turn_get_box, turn_ovelaps_box,
-                    piece_get_box, piece_ovelaps_box
-                >::apply(m_turns, m_pieces, visitor);
-
+            for (typename boost::range_iterator<turn_vector_type>::type it =
+                boost::begin(m_turns); it != boost::end(m_turns); ++it)
+            {
+                for (typename piece_rtree_type::const_query_iterator qit
+                        = piece_rtree.qbegin(
+                            geometry::index::intersects(it->robust_point));
+                     qit != piece_rtree.qend() && it->count_within == 0;
+                     ++qit)
+                {
+                    visitor.apply(*it, m_pieces[qit->second]);
+                }
+            }
         }
     }
 
@@ -1384,7 +1433,7 @@ struct buffered_piece_collection
     {
         typedef detail::overlay::ring_properties<point_type> properties;
 
-        std::map<ring_identifier, properties> selected;
+        detail::overlay::ring_identifier_map<properties> selected;
 
         // Select all rings which do not have any self-intersection
         // Inner rings, for deflate, which do not have intersections, and
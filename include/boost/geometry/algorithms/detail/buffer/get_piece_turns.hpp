@@ -262,7 +262,7 @@ public:
     {}
 
     template <typename Section>
-    inline void apply(Section const& section1, Section const& section2,
+    inline bool apply(Section const& section1, Section const& section2,
                     bool first = true)
     {
         boost::ignore_unused_variable_warning(first);
@@ -277,10 +277,12 @@ public:
           || detail::disjoint::disjoint_box_box(section1.bounding_box,
                     section2.bounding_box) )
         {
-            return;
+            return true;
         }
 
         calculate_turns(piece1, piece2, section1, section2);
+
+        return true;
     }
 };
 
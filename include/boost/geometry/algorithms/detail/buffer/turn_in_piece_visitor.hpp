@@ -46,34 +46,6 @@ namespace boost { namespace geometry
 namespace detail { namespace buffer
 {
 
-struct piece_get_box
-{
-    template <typename Box, typename Piece>
-    static inline void apply(Box& total, Piece const& piece)
-    {
-        geometry::expand(total, piece.robust_envelope);
-    }
-};
-
-struct piece_ovelaps_box
-{
-    template <typename Box, typename Piece>
-    static inline bool apply(Box const& box, Piece const& piece)
-    {
-        if (piece.type == strategy::buffer::buffered_flat_end
-            || piece.type == strategy::buffer::buffered_concave)
-        {
-            // Turns cannot be inside a flat end (though they can be on border)
-            // Neither we need to check if they are inside concave helper pieces
-
-            // Skip all pieces not used as soon as possible
-            return false;
-        }
-
-        return ! geometry::detail::disjoint::disjoint_box_box(box, piece.robust_envelope);
-    }
-};
-
 struct turn_get_box
 {
     template <typename Box, typename Turn>
@@ -83,15 +55,6 @@ struct turn_get_box
     }
 };
 
-struct turn_ovelaps_box
-{
-    template <typename Box, typename Turn>
-    static inline bool apply(Box const& box, Turn const& turn)
-    {
-        return ! geometry::detail::disjoint::disjoint_point_box(turn.robust_point, box);
-    }
-};
-
 
 enum analyse_result
 {
@@ -686,32 +649,32 @@ public:
     {}
 
     template <typename Turn, typename Piece>
-    inline void apply(Turn const& turn, Piece const& piece, bool first = true)
+    inline bool apply(Turn const& turn, Piece const& piece, bool first = true)
     {
         boost::ignore_unused_variable_warning(first);
 
         if (turn.count_within > 0)
         {
             // Already inside - no need to check again
-            return;
+            return true;
         }
 
         if (piece.type == strategy::buffer::buffered_flat_end
             || piece.type == strategy::buffer::buffered_concave)
         {
             // Turns cannot be located within flat-end or concave pieces
-            return;
+            return true;
         }
 
         if (! geometry::covered_by(turn.robust_point, piece.robust_envelope))
         {
             // Easy check: if the turn is not in the envelope, we can safely return
-            return;
+            return true;
         }
 
         if (skip(turn.operations[0], piece) || skip(turn.operations[1], piece))
         {
-            return;
+            return true;
         }
 
         // TODO: mutable_piece to make some on-demand preparations in analyse
@@ -733,11 +696,11 @@ public:
             if (cd < piece.robust_min_comparable_radius)
             {
                 mutable_turn.count_within++;
-                return;
+                return true;
             }
             if (cd > piece.robust_max_comparable_radius)
             {
-                return;
+                return true;
             }
         }
 
@@ -749,20 +712,20 @@ public:
         switch(analyse_code)
         {
             case analyse_disjoint :
-                return;
+                return true;
             case analyse_on_offsetted :
                 mutable_turn.count_on_offsetted++; // value is not used anymore
-                return;
+                return true;
             case analyse_on_original_boundary :
                 mutable_turn.count_on_original_boundary++;
-                return;
+                return true;
             case analyse_within :
                 mutable_turn.count_within++;
-                return;
+                return true;
 #if ! defined(BOOST_GEOMETRY_BUFFER_USE_SIDE_OF_INTERSECTION)
             case analyse_near_offsetted :
                 mutable_turn.count_within_near_offsetted++;
-                return;
+                return true;
 #endif
             default :
                 break;
@@ -790,6 +753,8 @@ public:
         {
             mutable_turn.count_within++;
         }
+
+        return true;
     }
 };
 
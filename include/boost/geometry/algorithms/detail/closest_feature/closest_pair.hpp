@@ -0,0 +1,463 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Licensed under the Boost Software License version 1.0.
+// http://www.boost.org/users/license.html
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_FEATURE_CLOSEST_PAIR_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_FEATURE_CLOSEST_PAIR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/mpl/bool.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+
+#include <boost/geometry/strategies/cartesian/distance_projected_point.hpp>
+#include <boost/geometry/strategies/cartesian/distance_pythagoras.hpp>
+
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace closest_feature
+{
+
+
+// Indicates if a (comparable) distance strategy returns the squared
+// cartesian distance, such that the squared distance between two boxes
+// is a lower bound for the distance between any features within them
+template <typename Strategy>
+struct is_squared_cartesian : boost::mpl::false_
+{};
+
+template <typename CalculationType>
+struct is_squared_cartesian
+    <
+        strategy::distance::comparable::pythagoras<CalculationType>
+    > : boost::mpl::true_
+{};
+
+template <typename CalculationType, typename PointStrategy>
+struct is_squared_cartesian
+    <
+        strategy::distance::projected_point<CalculationType, PointStrategy>
+    > : is_squared_cartesian<PointStrategy>
+{};
+
+
+template
+<
+    typename Box1, typename Box2,
+    std::size_t Dimension, std::size_t DimensionCount
+>
+struct box_box_squared_distance
+{
+    template <typename T>
+    static inline T apply(Box1 const& box1, Box2 const& box2)
+    {
+        T const min1 = get<min_corner, Dimension>(box1);
+        T const max1 = get<max_corner, Dimension>(box1);
+        T const min2 = get<min_corner, Dimension>(box2);
+        T const max2 = get<max_corner, Dimension>(box2);
+
+        T const diff = min1 > max2 ? min1 - max2
+                     : min2 > max1 ? min2 - max1
+                     : T(0);
+
+        return diff * diff
+            + box_box_squared_distance
+                <
+                    Box1, Box2, Dimension + 1, DimensionCount
+                >::template apply<T>(box1, box2);
+    }
+};
+
+template <typename Box1, typename Box2, std::size_t DimensionCount>
+struct box_box_squared_distance<Box1, Box2, DimensionCount, DimensionCount>
+{
+    template <typename T>
+    static inline T apply(Box1 const& , Box2 const& )
+    {
+        return T(0);
+    }
+};
+
+
+// A bounding volume hierarchy over the features of one range, built by
+// splitting the features along the widest dimension of their box, at the
+// median, until a node contains at most leaf_size features
+template <typename Iterator, typename Box>
+class closest_pair_tree
+{
+public :
+    static const std::size_t leaf_size = 8;
+
+    struct node
+    {
+        Box box;
+        std::size_t first;
+        std::size_t last;
+        std::size_t child1;
+        std::size_t child2;
+
+        inline bool is_leaf() const
+        {
+            return child1 == 0;
+        }
+    };
+
+    typedef std::pair<Box, Iterator> item_type;
+
+    inline closest_pair_tree(Iterator first, Iterator last)
+    {
+        for (Iterator it = first; it != last; ++it)
+        {
+            item_type item;
+            geometry::envelope(*it, item.first);
+            item.second = it;
+            m_items.push_back(item);
+        }
+
+        BOOST_GEOMETRY_ASSERT(! m_items.empty());
+        m_nodes.reserve(2 * (m_items.size() / leaf_size) + 1);
+        build(0, m_items.size());
+    }
+
+    inline node const& get_node(std::size_t index) const
+    {
+        return m_nodes[index];
+    }
+
+    inline item_type const& get_item(std::size_t index) const
+    {
+        return m_items[index];
+    }
+
+private :
+
+    template <std::size_t Dimension>
+    struct less_center
+    {
+        inline bool operator()(item_type const& left,
+                               item_type const& right) const
+        {
+            return get<min_corner, Dimension>(left.first)
+                    + get<max_corner, Dimension>(left.first)
+                 < get<min_corner, Dimension>(right.first)
+                    + get<max_corner, Dimension>(right.first);
+        }
+    };
+
+    inline std::size_t build(std::size_t first, std::size_t last)
+    {
+        std::size_t const index = m_nodes.size();
+        m_nodes.push_back(node());
+
+        Box box = m_items[first].first;
+        for (std::size_t i = first + 1; i < last; i++)
+        {
+            geometry::expand(box, m_items[i].first);
+        }
+
+        node n;
+        n.box = box;
+        n.first = first;
+        n.last = last;
+        n.child1 = 0;
+        n.child2 = 0;
+
+        if (last - first > leaf_size)
+        {
+            std::size_t const middle = first + (last - first) / 2;
+            if (get<max_corner, 0>(box) - get<min_corner, 0>(box)
+                >= get<max_corner, 1>(box) - get<min_corner, 1>(box))
+            {
+                std::nth_element(m_items.begin() + first,
+                        m_items.begin() + middle,
+                        m_items.begin() + last, less_center<0>());
+            }
+            else
+            {
+                std::nth_element(m_items.begin() + first,
+                        m_items.begin() + middle,
+                        m_items.begin() + last, less_center<1>());
+            }
+            n.child1 = build(first, middle);
+            n.child2 = build(middle, last);
+        }
+
+        m_nodes[index] = n;
+        return index;
+    }
+
+    std::vector<item_type> m_items;
+    std::vector<node> m_nodes;
+};
+
+
+// Finds the closest pair of features of two ranges by a branch-and-bound
+// traversal of two bounding volume hierarchies. Pairs of nodes are visited
+// in order of the distance of their boxes, and pairs which cannot contain
+// a pair closer than the closest pair found so far are skipped.
+// The distance strategy should return the squared cartesian distance.
+class closest_pair
+{
+private :
+
+    template <typename Distance>
+    struct node_pair
+    {
+        Distance distance;
+        std::size_t node1;
+        std::size_t node2;
+
+        inline node_pair(Distance const& d, std::size_t n1, std::size_t n2)
+            : distance(d)
+            , node1(n1)
+            , node2(n2)
+        {}
+
+        // Sorts the priority queue such that the smallest is on top
+        inline bool operator<(node_pair const& other) const
+        {
+            return distance > other.distance;
+        }
+    };
+
+public :
+
+    template
+    <
+        typename Iterator1,
+        typename Iterator2,
+        typename Strategy,
+        typename Distance
+    >
+    static inline void apply(Iterator1 first1, Iterator1 last1,
+                             Iterator2 first2, Iterator2 last2,
+                             Strategy const& strategy,
+                             Iterator1& it_min1,
+                             Iterator2& it_min2,
+                             Distance& dist_min)
+    {
+        typedef typename std::iterator_traits<Iterator1>::value_type value1;
+        typedef typename std::iterator_traits<Iterator2>::value_type value2;
+        typedef model::box<typename point_type<value1>::type> box1_type;
+        typedef model::box<typename point_type<value2>::type> box2_type;
+        typedef closest_pair_tree<Iterator1, box1_type> tree1_type;
+        typedef closest_pair_tree<Iterator2, box2_type> tree2_type;
+        typedef typename tree1_type::node node1_type;
+        typedef typename tree2_type::node node2_type;
+        typedef node_pair<Distance> node_pair_type;
+
+        tree1_type const tree1(first1, last1);
+        tree2_type const tree2(first2, last2);
+
+        bool found = false;
+        dist_min = Distance(0);
+
+        std::priority_queue<node_pair_type> queue;
+        queue.push(node_pair_type(
+            box_distance<Distance>(tree1.get_node(0).box,
+                                   tree2.get_node(0).box), 0, 0));
+
+        while (! queue.empty())
+        {
+            node_pair_type const pair = queue.top();
+            queue.pop();
+
+            if (found && ! (pair.distance < dist_min))
+            {
+                // All remaining pairs are at least as far away
+                return;
+            }
+
+            node1_type const& n1 = tree1.get_node(pair.node1);
+            node2_type const& n2 = tree2.get_node(pair.node2);
+
+            if (n1.is_leaf() && n2.is_leaf())
+            {
+                for (std::size_t i = n1.first; i < n1.last; i++)
+                {
+                    for (std::size_t j = n2.first; j < n2.last; j++)
+                    {
+                        Iterator1 const it1 = tree1.get_item(i).second;
+                        Iterator2 const it2 = tree2.get_item(j).second;
+                        Distance const dist = dispatch::distance
+                            <
+                                value1, value2, Strategy
+                            >::apply(*it1, *it2, strategy);
+
+                        if (! found || dist < dist_min)
+                        {
+                            found = true;
+                            dist_min = dist;
+                            it_min1 = it1;
+                            it_min2 = it2;
+                            if (math::equals(dist_min, Distance(0)))
+                            {
+                                return;
+                            }
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // Split the largest node (or the only one which is not a leaf)
+            bool const split1 = ! n1.is_leaf()
+                && (n2.is_leaf() || n1.last - n1.first >= n2.last - n2.first);
+
+            if (split1)
+            {
+                push(queue, tree1, tree2, n1.child1, pair.node2, found, dist_min);
+                push(queue, tree1, tree2, n1.child2, pair.node2, found, dist_min);
+            }
+            else
+            {
+                push(queue, tree1, tree2, pair.node1, n2.child1, found, dist_min);
+                push(queue, tree1, tree2, pair.node1, n2.child2, found, dist_min);
+            }
+        }
+    }
+
+    // Returns true if the ranges contain a pair of features at a distance
+    // not exceeding max_distance, and returns as soon as such a pair is
+    // found. Pairs of nodes further away are skipped.
+    template
+    <
+        typename Iterator1,
+        typename Iterator2,
+        typename Strategy,
+        typename Distance
+    >
+    static inline bool within(Iterator1 first1, Iterator1 last1,
+                              Iterator2 first2, Iterator2 last2,
+                              Strategy const& strategy,
+                              Distance const& max_distance)
+    {
+        typedef typename std::iterator_traits<Iterator1>::value_type value1;
+        typedef typename std::iterator_traits<Iterator2>::value_type value2;
+        typedef model::box<typename point_type<value1>::type> box1_type;
+        typedef model::box<typename point_type<value2>::type> box2_type;
+        typedef closest_pair_tree<Iterator1, box1_type> tree1_type;
+        typedef closest_pair_tree<Iterator2, box2_type> tree2_type;
+        typedef typename tree1_type::node node1_type;
+        typedef typename tree2_type::node node2_type;
+
+        tree1_type const tree1(first1, last1);
+        tree2_type const tree2(first2, last2);
+
+        std::vector<std::pair<std::size_t, std::size_t> > stack;
+        stack.push_back(std::make_pair(0u, 0u));
+
+        while (! stack.empty())
+        {
+            std::pair<std::size_t, std::size_t> const pair = stack.back();
+            stack.pop_back();
+
+            node1_type const& n1 = tree1.get_node(pair.first);
+            node2_type const& n2 = tree2.get_node(pair.second);
+
+            if (max_distance < box_distance<Distance>(n1.box, n2.box))
+            {
+                continue;
+            }
+
+            if (n1.is_leaf() && n2.is_leaf())
+            {
+                for (std::size_t i = n1.first; i < n1.last; i++)
+                {
+                    for (std::size_t j = n2.first; j < n2.last; j++)
+                    {
+                        Distance const dist = dispatch::distance
+                            <
+                                value1, value2, Strategy
+                            >::apply(*tree1.get_item(i).second,
+                                     *tree2.get_item(j).second,
+                                     strategy);
+                        if (! (max_distance < dist))
+                        {
+                            return true;
+                        }
+                    }
+                }
+                continue;
+            }
+
+            bool const split1 = ! n1.is_leaf()
+                && (n2.is_leaf() || n1.last - n1.first >= n2.last - n2.first);
+
+            if (split1)
+            {
+                stack.push_back(std::make_pair(n1.child1, pair.second));
+                stack.push_back(std::make_pair(n1.child2, pair.second));
+            }
+            else
+            {
+                stack.push_back(std::make_pair(pair.first, n2.child1));
+                stack.push_back(std::make_pair(pair.first, n2.child2));
+            }
+        }
+        return false;
+    }
+
+private :
+
+    template <typename Distance, typename Box1, typename Box2>
+    static inline Distance box_distance(Box1 const& box1, Box2 const& box2)
+    {
+        return box_box_squared_distance
+            <
+                Box1, Box2, 0, dimension<Box1>::value
+            >::template apply<Distance>(box1, box2);
+    }
+
+    template
+    <
+        typename Queue,
+        typename Tree1,
+        typename Tree2,
+        typename Distance
+    >
+    static inline void push(Queue& queue, Tree1 const& tree1, Tree2 const& tree2,
+                            std::size_t node1, std::size_t node2,
+                            bool found, Distance const& dist_min)
+    {
+        Distance const distance
+            = box_distance<Distance>(tree1.get_node(node1).box,
+                                     tree2.get_node(node2).box);
+        if (! found || distance < dist_min)
+        {
+            queue.push(typename Queue::value_type(distance, node1, node2));
+        }
+    }
+};
+
+
+}} // namespace detail::closest_feature
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_FEATURE_CLOSEST_PAIR_HPP
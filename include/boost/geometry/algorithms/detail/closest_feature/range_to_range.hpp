@@ -15,10 +15,13 @@
 #include <iterator>
 #include <utility>
 
+#include <boost/mpl/bool.hpp>
+
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/algorithms/detail/closest_feature/closest_pair.hpp>
 #include <boost/geometry/index/rtree.hpp>
 
 
@@ -32,7 +35,9 @@ namespace detail { namespace closest_feature
 
 // returns a pair of a objects where the first is an object of the
 // r-tree range and the second an object of the query range that
-// realizes the closest feature of the two ranges
+// realizes the closest feature of the two ranges;
+// for squared cartesian distances both ranges are indexed and searched
+// together, otherwise the r-tree is queried for each query range object
 class range_to_range_rtree
 {
 private:
@@ -51,7 +56,35 @@ private:
                              Strategy const& strategy,
                              RTreeValueType& rtree_min,
                              QueryRangeIterator& qit_min,
-                             Distance& dist_min)
+                             Distance& dist_min,
+                             boost::mpl::true_ /*squared cartesian*/)
+    {
+        // Both ranges are indexed, and node pairs are pruned by the
+        // closest distance found so far
+        RTreeRangeIterator rit_min;
+        closest_pair::apply(rtree_first, rtree_last,
+                            queries_first, queries_last,
+                            strategy, rit_min, qit_min, dist_min);
+        rtree_min = *rit_min;
+    }
+
+    template
+    <
+        typename RTreeRangeIterator,
+        typename QueryRangeIterator,
+        typename Strategy,
+        typename RTreeValueType,
+        typename Distance
+    >
+    static inline void apply(RTreeRangeIterator rtree_first,
+                             RTreeRangeIterator rtree_last,
+                             QueryRangeIterator queries_first,
+                             QueryRangeIterator queries_last,
+                             Strategy const& strategy,
+                             RTreeValueType& rtree_min,
+                             QueryRangeIterator& qit_min,
+                             Distance& dist_min,
+                             boost::mpl::false_ /*squared cartesian*/)
     {
         typedef index::rtree<RTreeValueType, index::linear<8> > rtree_type;
 
@@ -142,7 +175,8 @@ public:
         QueryRangeIterator qit_min;
 
         apply(rtree_first, rtree_last, queries_first, queries_last,
-              strategy, rtree_min, qit_min, dist_min);
+              strategy, rtree_min, qit_min, dist_min,
+              is_squared_cartesian<Strategy>());
 
         return std::make_pair(rtree_min, qit_min);        
     }
@@ -131,13 +131,15 @@ private:
         item_visitor_type() : m_intersection_found(false) {}
 
         template <typename Item1, typename Item2>
-        inline void apply(Item1 const& item1, Item2 const& item2)
+        inline bool apply(Item1 const& item1, Item2 const& item2)
         {
             if (! m_intersection_found
                 && ! dispatch::disjoint<Item1, Item2>::apply(item1, item2))
             {
                 m_intersection_found = true;
+                return false;
             }
+            return true;
         }
 
         inline bool intersection_found() const { return m_intersection_found; }
@@ -301,6 +301,125 @@ inline bool intersection(Geometry1 const& geometry1,
 }
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+// Intersection using a workspace. Areal geometries with a box are clipped
+// (as by the intersection_insert dispatch), which needs no workspace,
+// other areal geometries are overlayed using the workspace.
+template
+<
+    typename Geometry1, typename Geometry2, typename GeometryOut,
+    bool Clip1 = is_areal_box_clip<Geometry1, Geometry2, GeometryOut>::value,
+    bool Clip2 = is_areal_box_clip<Geometry2, Geometry1, GeometryOut>::value
+>
+struct intersection_with_workspace
+{
+    template <typename OutputIterator, typename Workspace>
+    static inline OutputIterator apply(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            OutputIterator out,
+            Workspace& workspace)
+    {
+        return detail::overlay::overlay_insert
+            <
+                GeometryOut, overlay_intersection
+            >(geometry1, geometry2, out, workspace);
+    }
+};
+
+template <typename Areal, typename Box, typename GeometryOut>
+struct intersection_with_workspace<Areal, Box, GeometryOut, true, false>
+{
+    template <typename OutputIterator, typename Workspace>
+    static inline OutputIterator apply(Areal const& areal, Box const& box,
+            OutputIterator out,
+            Workspace& )
+    {
+        typedef intersection_strategies
+            <
+                typename cs_tag<GeometryOut>::type,
+                Areal,
+                Box,
+                typename geometry::point_type<GeometryOut>::type,
+                detail::no_rescale_policy
+            > strategy;
+
+        // The clipper uses neither the rescale policy nor the strategy
+        return intersection_areal_box
+            <
+                Areal, Box, GeometryOut
+            >::apply(areal, box, detail::no_rescale_policy(), out, strategy());
+    }
+};
+
+template <typename Box, typename Areal, typename GeometryOut>
+struct intersection_with_workspace<Box, Areal, GeometryOut, false, true>
+{
+    template <typename OutputIterator, typename Workspace>
+    static inline OutputIterator apply(Box const& box, Areal const& areal,
+            OutputIterator out,
+            Workspace& workspace)
+    {
+        return intersection_with_workspace
+            <
+                Areal, Box, GeometryOut
+            >::apply(areal, box, out, workspace);
+    }
+};
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_calc2{intersection}, reusing intermediate containers
+\ingroup intersection
+\details \details_calc2{intersection, spatial set theoretic intersection}.
+    The intermediate results are stored in the specified workspace, such
+    that its allocated capacity can be reused by subsequent calls.
+    This overload is only available for areal geometries. An areal
+    geometry and a box are clipped without the overlay, as by the
+    overloads without workspace.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Collection output collection of areal geometries
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+\param workspace overlay_workspace, having the same point type as the output
+
+\qbk{distinguish,with workspace}
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Collection,
+    typename WorkspaceGeometry,
+    typename RobustPolicy
+>
+inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection,
+            overlay_workspace<WorkspaceGeometry, RobustPolicy>& workspace)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+
+    typedef typename boost::range_value<Collection>::type geometry_out;
+    concepts::check<geometry_out>();
+
+    detail::intersection::intersection_with_workspace
+        <
+            Geometry1, Geometry2, geometry_out
+        >::apply(geometry1, geometry2,
+                 range::back_inserter(output_collection), workspace);
+    return true;
+}
+
+
 }} // namespace boost::geometry
 
 
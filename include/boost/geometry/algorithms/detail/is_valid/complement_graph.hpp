@@ -12,8 +12,7 @@
 
 #include <cstddef>
 
-#include <set>
-#include <stack>
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -22,6 +21,8 @@
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/policies/compare.hpp>
 
+#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+
 
 namespace boost { namespace geometry
 {
@@ -30,190 +31,141 @@ namespace detail { namespace is_valid
 {
 
 
-template <typename TurnPoint>
-class complement_graph_vertex
-{
-public:
-    complement_graph_vertex(std::size_t id)
-        : m_id(id)
-        , m_turn_point(NULL)
-    {}
-
-    complement_graph_vertex(TurnPoint const* turn_point,
-                            std::size_t expected_id)
-        : m_id(expected_id)
-        , m_turn_point(turn_point)
-    {}
-
-    inline std::size_t id() const { return m_id; }
-
-    inline bool operator<(complement_graph_vertex const& other) const
-    {
-        if ( m_turn_point != NULL && other.m_turn_point != NULL )
-        {
-            return geometry::less
-                <
-                    TurnPoint
-                >()(*m_turn_point, *other.m_turn_point);
-        }
-        if ( m_turn_point == NULL && other.m_turn_point == NULL )
-        {
-            return m_id < other.m_id;
-        }
-        return m_turn_point == NULL;
-    }
-
-private:
-    // the value of m_turn_point determines the type of the vertex
-    // non-NULL: vertex corresponds to an IP
-    // NULL    : vertex corresponds to a hole or outer space, and the id
-    //           is the ring id of the corresponding ring of the polygon
-    std::size_t m_id;
-    TurnPoint const* m_turn_point;
-};
-
-
-
-
+// The complement graph of a polygon is a bipartite graph having one vertex
+// per ring (including the exterior ring, denoting the outer space) and one
+// vertex per distinct turn point. Rings are connected to the turn points
+// located on them. The interior of the polygon is connected if and only if
+// this graph is acyclic.
+//
+// The graph is stored as a flat list of edges. Cycles are detected by
+// union-find over these edges, after turn points are identified by sorting.
 template <typename TurnPoint>
 class complement_graph
 {
 private:
-    typedef complement_graph_vertex<TurnPoint> vertex;
-    typedef std::set<vertex> vertex_container;
-
-public:
-    typedef typename vertex_container::const_iterator vertex_handle;
+    typedef std::pair<std::size_t, TurnPoint const*> ring_turn_point;
+    typedef std::pair<std::size_t, std::size_t> edge;
 
-private:
-    struct vertex_handle_less
+    struct less_by_turn_point
     {
-        inline bool operator()(vertex_handle v1, vertex_handle v2) const
+        inline bool operator()(ring_turn_point const& left,
+                               ring_turn_point const& right) const
         {
-            return v1->id() < v2->id();
+            return geometry::less<TurnPoint>()(*left.second, *right.second);
         }
     };
 
-    typedef std::set<vertex_handle, vertex_handle_less> neighbor_container;
-
-    class has_cycles_dfs_data
+    class disjoint_sets
     {
     public:
-        has_cycles_dfs_data(std::size_t num_nodes)
-            : m_visited(num_nodes, false)
-            , m_parent_id(num_nodes, -1)
-        {}
-
-        inline signed_size_type parent_id(vertex_handle v) const
+        explicit disjoint_sets(std::size_t count)
+            : m_parent(count)
+            , m_rank(count, 0)
         {
-            return m_parent_id[v->id()];
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                m_parent[i] = i;
+            }
         }
 
-        inline void set_parent_id(vertex_handle v, signed_size_type id)
+        inline std::size_t find(std::size_t v)
         {
-            m_parent_id[v->id()] = id;
+            while (m_parent[v] != v)
+            {
+                // path halving
+                m_parent[v] = m_parent[m_parent[v]];
+                v = m_parent[v];
+            }
+            return v;
         }
 
-        inline bool visited(vertex_handle v) const
+        // Returns false if both were already in the same set
+        inline bool unite(std::size_t v1, std::size_t v2)
         {
-            return m_visited[v->id()];
+            std::size_t r1 = find(v1);
+            std::size_t r2 = find(v2);
+            if (r1 == r2)
+            {
+                return false;
+            }
+            if (m_rank[r1] < m_rank[r2])
+            {
+                std::swap(r1, r2);
+            }
+            m_parent[r2] = r1;
+            if (m_rank[r1] == m_rank[r2])
+            {
+                m_rank[r1]++;
+            }
+            return true;
         }
 
-        inline void set_visited(vertex_handle v, bool value)
-        {
-            m_visited[v->id()] = value;
-        }
     private:
-        std::vector<bool> m_visited;
-        std::vector<signed_size_type> m_parent_id;
+        std::vector<std::size_t> m_parent;
+        std::vector<unsigned char> m_rank;
     };
 
-
-    inline bool has_cycles(vertex_handle start_vertex,
-                           has_cycles_dfs_data& data) const
+    // Assigns vertex ids to the turn points (equal points get the same id,
+    // following the ring ids) and returns the sorted, distinct edges
+    inline std::size_t make_edges(std::vector<edge>& edges) const
     {
-        std::stack<vertex_handle> stack;
-        stack.push(start_vertex);
+        std::vector<ring_turn_point> sorted(m_ring_turn_points);
+        std::sort(sorted.begin(), sorted.end(), less_by_turn_point());
 
-        while ( !stack.empty() )
-        {
-            vertex_handle v = stack.top();
-            stack.pop();
+        edges.clear();
+        edges.reserve(sorted.size());
 
-            data.set_visited(v, true);
-            for (typename neighbor_container::const_iterator nit
-                     = m_neighbors[v->id()].begin();
-                 nit != m_neighbors[v->id()].end(); ++nit)
+        std::size_t vertex_count = m_num_rings;
+        geometry::less<TurnPoint> less;
+        for (std::size_t i = 0; i < sorted.size(); ++i)
+        {
+            if (i == 0 || less(*sorted[i - 1].second, *sorted[i].second))
             {
-                if ( static_cast<signed_size_type>((*nit)->id()) != data.parent_id(v) )
-                {
-                    if ( data.visited(*nit) )
-                    {
-                        return true;
-                    }
-                    else
-                    {
-                        data.set_parent_id(*nit, static_cast<signed_size_type>(v->id()));
-                        stack.push(*nit);
-                    }
-                }
+                // new turn point
+                vertex_count++;
             }
+            edges.push_back(edge(sorted[i].first, vertex_count - 1));
         }
-        return false;
+
+        // duplicate edges (a ring touching itself, or several turns at
+        // the same point) do not form cycles
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        return vertex_count;
     }
 
 public:
     // num_rings: total number of rings, including the exterior ring
     complement_graph(std::size_t num_rings)
         : m_num_rings(num_rings)
-        , m_num_turns(0)
-        , m_vertices()
-        , m_neighbors(num_rings)
     {}
 
-    // inserts a ring vertex in the graph and returns its handle
-    // ring id's are zero-based (so the first interior ring has id 1)
-    inline vertex_handle add_vertex(signed_size_type id)
+    inline void reserve(std::size_t turn_count)
     {
-        return m_vertices.insert(vertex(static_cast<std::size_t>(id))).first;
+        m_ring_turn_points.reserve(2 * turn_count);
     }
 
-    // inserts an IP in the graph and returns its id
-    inline vertex_handle add_vertex(TurnPoint const& turn_point)
-    {
-        std::pair<vertex_handle, bool> res
-            = m_vertices.insert(vertex(boost::addressof(turn_point),
-                                       m_num_rings + m_num_turns)
-                                );
-
-        if ( res.second )
-        {
-            // a new element is inserted
-            m_neighbors.push_back(neighbor_container());
-            ++m_num_turns;
-        }
-        return res.first;
-    }
-
-    inline void add_edge(vertex_handle v1, vertex_handle v2)
+    // adds an edge between a ring and a turn point located on it
+    // ring id's are zero-based (so the first interior ring has id 1)
+    inline void add_edge(signed_size_type ring_id, TurnPoint const& turn_point)
     {
-        BOOST_GEOMETRY_ASSERT( v1 != m_vertices.end() );
-        BOOST_GEOMETRY_ASSERT( v2 != m_vertices.end() );
-        m_neighbors[v1->id()].insert(v2);
-        m_neighbors[v2->id()].insert(v1);
+        BOOST_GEOMETRY_ASSERT(ring_id >= 0
+                              && static_cast<std::size_t>(ring_id) < m_num_rings);
+        m_ring_turn_points.push_back(
+            ring_turn_point(static_cast<std::size_t>(ring_id),
+                            boost::addressof(turn_point)));
     }
 
     inline bool has_cycles() const
     {
-        // initialize all vertices as non-visited and with no parent set
-        // this is done by the constructor of has_cycles_dfs_data
-        has_cycles_dfs_data data(m_num_rings + m_num_turns);
+        std::vector<edge> edges;
+        std::size_t const vertex_count = make_edges(edges);
 
-        // for each non-visited vertex, start a DFS from that vertex
-        for (vertex_handle it = m_vertices.begin();
-             it != m_vertices.end(); ++it)
+        disjoint_sets sets(vertex_count);
+        for (std::size_t i = 0; i < edges.size(); ++i)
         {
-            if ( !data.visited(it) && has_cycles(it, data) )
+            if (! sets.unite(edges[i].first, edges[i].second))
             {
                 return true;
             }
@@ -226,9 +178,8 @@ public:
     void debug_print_complement_graph(OStream&, complement_graph<TP> const&);
 
 private:
-    std::size_t m_num_rings, m_num_turns;
-    vertex_container m_vertices;
-    std::vector<neighbor_container> m_neighbors;
+    std::size_t m_num_rings;
+    std::vector<ring_turn_point> m_ring_turn_points;
 };
 
 
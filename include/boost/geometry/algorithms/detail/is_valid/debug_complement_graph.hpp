@@ -12,6 +12,7 @@
 
 #ifdef BOOST_GEOMETRY_TEST_DEBUG
 #include <iostream>
+#include <vector>
 #endif
 
 namespace boost { namespace geometry
@@ -27,32 +28,20 @@ inline void
 debug_print_complement_graph(OutputStream& os,
                              complement_graph<TurnPoint> const& graph)
 {
-    typedef typename complement_graph<TurnPoint>::vertex_handle vertex_handle;
+    typedef typename complement_graph<TurnPoint>::edge edge;
 
-    os << "num rings: " << graph.m_num_rings << std::endl;
-    os << "vertex ids: {";
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
-    {
-        os << " " << it->id();
-    }
-    os << " }" << std::endl;        
+    std::vector<edge> edges;
+    std::size_t const vertex_count = graph.make_edges(edges);
 
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
+    os << "num rings: " << graph.m_num_rings << std::endl;
+    os << "num vertices: " << vertex_count << std::endl;
+    os << "edges: {";
+    for (typename std::vector<edge>::const_iterator it = edges.begin();
+         it != edges.end(); ++it)
     {
-        os << "neighbors of " << it->id() << ": {";
-        for (typename complement_graph
-                 <
-                     TurnPoint
-                 >::neighbor_container::const_iterator
-                 nit = graph.m_neighbors[it->id()].begin();
-             nit != graph.m_neighbors[it->id()].end(); ++nit)
-        {
-            os << " " << (*nit)->id();
-        }
-        os << "}" << std::endl;        
+        os << " " << it->first << "-" << it->second;
     }
+    os << " }" << std::endl;
 }
 #else
 template <typename OutputStream, typename TurnPoint>
@@ -13,18 +13,23 @@
 #include <vector>
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/mpl/vector_c.hpp>
 #include <boost/range.hpp>
 
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/point_type.hpp>
 
+#include <boost/geometry/geometries/box.hpp>
+
 #include <boost/geometry/policies/predicate_based_interrupt_policy.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
 #include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
 #include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
 
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
 
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
 
@@ -68,14 +73,41 @@ public:
                 >::type
         > turn_type;
 
+    // The sections of the geometry, in (possibly) rescaled coordinates
+    typedef geometry::sections
+        <
+            model::box
+                <
+                    typename geometry::robust_point_type
+                        <
+                            point_type, rescale_policy_type
+                        >::type
+                >,
+            1
+        > sections_type;
+
     // returns true if all turns are valid
     template <typename Turns, typename VisitPolicy>
     static inline bool apply(Geometry const& geometry,
                              Turns& turns,
                              VisitPolicy& visitor)
+    {
+        sections_type sections;
+        return apply(geometry, sections, turns, visitor);
+    }
+
+    // returns true if all turns are valid, and keeps the sections used to
+    // find them, such that the caller can reuse them
+    template <typename Turns, typename VisitPolicy>
+    static inline bool apply(Geometry const& geometry,
+                             sections_type& sections,
+                             Turns& turns,
+                             VisitPolicy& visitor)
     {
         boost::ignore_unused(visitor);
 
+        typedef boost::mpl::vector_c<std::size_t, 0> dimensions;
+
         rescale_policy_type robust_policy
             = geometry::get_rescale_policy<rescale_policy_type>(geometry);
 
@@ -84,10 +116,15 @@ public:
                 IsAcceptableTurn
             > interrupt_policy;
 
-        geometry::self_turns<turn_policy>(geometry,
-                                          robust_policy,
-                                          turns,
-                                          interrupt_policy);
+        geometry::sectionalize<false, dimensions>(geometry, robust_policy,
+                sections, 0,
+                detail::sectionalize::default_max_count<point_type>());
+
+        detail::self_get_turn_points::get_turns
+            <
+                turn_policy
+            >::apply_sections(geometry, sections, robust_policy,
+                              turns, interrupt_policy);
 
         if (interrupt_policy.has_intersections)
         {
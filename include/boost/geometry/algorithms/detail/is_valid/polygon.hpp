@@ -18,7 +18,7 @@
 #include <algorithm>
 #include <deque>
 #include <iterator>
-#include <set>
+#include <utility>
 #include <vector>
 
 #include <boost/core/ignore_unused.hpp>
@@ -37,8 +37,10 @@
 
 #include <boost/geometry/iterators/point_iterator.hpp>
 
+#include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/covered_by.hpp>
 #include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/num_interior_rings.hpp>
 #include <boost/geometry/algorithms/validity_failure_type.hpp>
@@ -58,6 +60,8 @@
 
 #include <boost/geometry/algorithms/dispatch/is_valid.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 
 namespace boost { namespace geometry
 {
@@ -161,7 +165,7 @@ protected:
         item_visitor_type() : items_overlap(false) {}
 
         template <typename Item1, typename Item2>
-        inline void apply(Item1 const& item1, Item2 const& item2)
+        inline bool apply(Item1 const& item1, Item2 const& item2)
         {
             if (! items_overlap
                 && (geometry::within(*points_begin(*item1), *item2)
@@ -169,17 +173,75 @@ protected:
                 )
             {
                 items_overlap = true;
+                return false; // interrupt
             }
+            return true;
         }
     };
     // structs for partition -- end
 
 
+    // Gives the envelope of an interior ring, calculating it
+    struct ring_envelope
+    {
+        typedef geometry::model::box
+            <
+                typename point_type<Polygon>::type
+            > box_type;
+
+        template <typename Ring>
+        inline box_type apply(Ring const& ring, std::size_t ) const
+        {
+            return geometry::return_envelope<box_type>(ring);
+        }
+    };
+
+    // Gives the envelope of an interior ring, combined from the sections
+    // created for the self-turns. The boxes of rescaled sections are
+    // rescaled as well, but cover each other in the same way.
+    template <typename Sections>
+    class section_ring_envelope
+    {
+    public :
+        typedef typename Sections::box_type box_type;
+
+        inline section_ring_envelope(Sections const& sections,
+                                     std::size_t ring_count)
+            : m_boxes(ring_count)
+        {
+            for (std::size_t i = 0; i < ring_count; i++)
+            {
+                geometry::assign_inverse(m_boxes[i]);
+            }
+            for (typename boost::range_iterator<Sections const>::type
+                    it = boost::begin(sections);
+                 it != boost::end(sections);
+                 ++it)
+            {
+                if (it->ring_id.ring_index >= 0)
+                {
+                    geometry::expand(m_boxes[it->ring_id.ring_index],
+                                     it->bounding_box);
+                }
+            }
+        }
+
+        template <typename Ring>
+        inline box_type const& apply(Ring const& , std::size_t index) const
+        {
+            return m_boxes[index];
+        }
+
+    private :
+        std::vector<box_type> m_boxes;
+    };
+
     template
     <
         typename RingIterator,
         typename ExteriorRing,
         typename TurnIterator,
+        typename RingEnvelope,
         typename VisitPolicy
     >
     static inline bool are_holes_inside(RingIterator rings_first,
@@ -187,71 +249,75 @@ protected:
                                         ExteriorRing const& exterior_ring,
                                         TurnIterator turns_first,
                                         TurnIterator turns_beyond,
+                                        RingEnvelope const& ring_envelope,
                                         VisitPolicy& visitor)
     {
         boost::ignore_unused(visitor);
 
-        // collect the interior ring indices that have turns with the
-        // exterior ring
-        std::set<signed_size_type> ring_indices;
+        std::size_t const ring_count = std::distance(rings_first, rings_beyond);
+
+        // flag the interior rings that have turns with the exterior ring
+        std::vector<bool> has_turns(ring_count, false);
         for (TurnIterator tit = turns_first; tit != turns_beyond; ++tit)
         {
             if (tit->operations[0].seg_id.ring_index == -1)
             {
                 BOOST_GEOMETRY_ASSERT(tit->operations[1].seg_id.ring_index != -1);
-                ring_indices.insert(tit->operations[1].seg_id.ring_index);
+                has_turns[tit->operations[1].seg_id.ring_index] = true;
             }
             else if (tit->operations[1].seg_id.ring_index == -1)
             {
                 BOOST_GEOMETRY_ASSERT(tit->operations[0].seg_id.ring_index != -1);
-                ring_indices.insert(tit->operations[0].seg_id.ring_index);
+                has_turns[tit->operations[0].seg_id.ring_index] = true;
             }
         }
 
-        signed_size_type ring_index = 0;
+        std::size_t ring_index = 0;
         for (RingIterator it = rings_first; it != rings_beyond;
              ++it, ++ring_index)
         {
             // do not examine interior rings that have turns with the
             // exterior ring
-            if (ring_indices.find(ring_index) == ring_indices.end()
+            if (! has_turns[ring_index]
                 && ! geometry::covered_by(range::front(*it), exterior_ring))
             {
                 return visitor.template apply<failure_interior_rings_outside>();
             }
         }
 
-        // collect all rings (exterior and/or interior) that have turns
+        // flag all interior rings that have turns
         for (TurnIterator tit = turns_first; tit != turns_beyond; ++tit)
         {
-            ring_indices.insert(tit->operations[0].seg_id.ring_index);
-            ring_indices.insert(tit->operations[1].seg_id.ring_index);
+            for (int i = 0; i < 2; i++)
+            {
+                signed_size_type const index = tit->operations[i].seg_id.ring_index;
+                if (index >= 0)
+                {
+                    has_turns[index] = true;
+                }
+            }
         }
 
-        // put iterators for interior rings without turns in a vector
+        // put iterators for interior rings without turns in a vector,
+        // with their envelopes
+        typedef typename RingEnvelope::box_type box_type;
         std::vector<RingIterator> ring_iterators;
+        std::vector<std::pair<box_type, std::size_t> > boxes;
         ring_index = 0;
         for (RingIterator it = rings_first; it != rings_beyond;
              ++it, ++ring_index)
         {
-            if (ring_indices.find(ring_index) == ring_indices.end())
+            if (! has_turns[ring_index])
             {
+                boxes.push_back(std::make_pair(
+                    box_type(ring_envelope.apply(*it, ring_index)),
+                    ring_iterators.size()));
                 ring_iterators.push_back(it);
             }
         }
 
-        // call partition to check is interior rings are disjoint from
-        // each other
-        item_visitor_type item_visitor;
-
-        geometry::partition
-            <
-                geometry::model::box<typename point_type<Polygon>::type>,
-                expand_box,
-                overlaps_box
-            >::apply(ring_iterators, item_visitor);
-
-        if (item_visitor.items_overlap)
+        // check if interior rings are disjoint from each other
+        if (has_nested_rings(ring_iterators, boxes))
         {
             return visitor.template apply<failure_nested_interior_rings>();
         }
@@ -261,17 +327,59 @@ protected:
         }
     }
 
+    // Returns true if one of the rings (without turns) is located within
+    // another one. A ring can only be inside another ring if its envelope
+    // is covered by the envelope of the other ring. These candidates are
+    // found using a packed rtree of the envelopes.
+    template <typename RingIterator, typename BoxPair>
+    static inline bool has_nested_rings(std::vector<RingIterator> const& ring_iterators,
+                                        std::vector<BoxPair> const& boxes)
+    {
+        typedef BoxPair box_pair;
+
+        if (ring_iterators.size() < 2)
+        {
+            return false;
+        }
+
+        // the range constructor uses the packing algorithm
+        index::rtree<box_pair, index::rstar<16> > const rtree(boxes.begin(),
+                                                              boxes.end());
+
+        std::vector<box_pair> candidates;
+        for (std::size_t i = 0; i < boxes.size(); i++)
+        {
+            candidates.clear();
+            rtree.query(index::covers(boxes[i].first),
+                        std::back_inserter(candidates));
+
+            for (typename std::vector<box_pair>::const_iterator
+                    it = candidates.begin(); it != candidates.end(); ++it)
+            {
+                if (it->second != i
+                    && geometry::within(*points_begin(*ring_iterators[i]),
+                                        *ring_iterators[it->second]))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
     template
     <
         typename InteriorRings,
         typename ExteriorRing,
         typename TurnIterator,
+        typename RingEnvelope,
         typename VisitPolicy
     >
     static inline bool are_holes_inside(InteriorRings const& interior_rings,
                                         ExteriorRing const& exterior_ring,
                                         TurnIterator first,
                                         TurnIterator beyond,
+                                        RingEnvelope const& ring_envelope,
                                         VisitPolicy& visitor)
     {
         return are_holes_inside(boost::begin(interior_rings),
@@ -279,6 +387,7 @@ protected:
                                 exterior_ring,
                                 first,
                                 beyond,
+                                ring_envelope,
                                 visitor);
     }
 
@@ -294,6 +403,24 @@ protected:
                                     geometry::exterior_ring(polygon),
                                     first,
                                     beyond,
+                                    ring_envelope(),
+                                    visitor);
+        }
+
+        // The envelopes of the interior rings are taken from the sections
+        template <typename Sections, typename TurnIterator, typename VisitPolicy>
+        static inline bool apply(Polygon const& polygon,
+                                 Sections const& sections,
+                                 TurnIterator first,
+                                 TurnIterator beyond,
+                                 VisitPolicy& visitor)
+        {
+            return are_holes_inside(geometry::interior_rings(polygon),
+                                    geometry::exterior_ring(polygon),
+                                    first,
+                                    beyond,
+                                    section_ring_envelope<Sections>(sections,
+                                        geometry::num_interior_rings(polygon)),
                                     visitor);
         }
     };
@@ -318,16 +445,11 @@ protected:
             typedef complement_graph<typename turn_type::point_type> graph;
 
             graph g(geometry::num_interior_rings(polygon) + 1);
+            g.reserve(std::distance(first, beyond));
             for (TurnIterator tit = first; tit != beyond; ++tit)
             {
-                typename graph::vertex_handle v1 = g.add_vertex
-                    ( tit->operations[0].seg_id.ring_index + 1 );
-                typename graph::vertex_handle v2 = g.add_vertex
-                    ( tit->operations[1].seg_id.ring_index + 1 );
-                typename graph::vertex_handle vip = g.add_vertex(tit->point);
-
-                g.add_edge(v1, vip);
-                g.add_edge(v2, vip);
+                g.add_edge(tit->operations[0].seg_id.ring_index + 1, tit->point);
+                g.add_edge(tit->operations[1].seg_id.ring_index + 1, tit->point);
             }
 
 #ifdef BOOST_GEOMETRY_TEST_DEBUG
@@ -365,8 +487,9 @@ public:
         typedef has_valid_self_turns<Polygon> has_valid_turns;
 
         std::deque<typename has_valid_turns::turn_type> turns;
+        typename has_valid_turns::sections_type sections;
         bool has_invalid_turns
-            = ! has_valid_turns::apply(polygon, turns, visitor);
+            = ! has_valid_turns::apply(polygon, sections, turns, visitor);
         debug_print_turns(turns.begin(), turns.end());
 
         if (has_invalid_turns)
@@ -377,7 +500,9 @@ public:
         // check if all interior rings are inside the exterior ring
         debug_phase::apply(4);
 
-        if (! has_holes_inside::apply(polygon,
+        // the sections of the self-turns give the envelopes of the
+        // interior rings
+        if (! has_holes_inside::apply(polygon, sections,
                                       turns.begin(), turns.end(),
                                       visitor))
         {
@@ -9,7 +9,20 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ASSIGN_PARENTS_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ASSIGN_PARENTS_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <boost/range.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/envelope.hpp>
@@ -20,6 +33,11 @@
 
 #include <boost/geometry/geometries/box.hpp>
 
+#include <boost/geometry/strategies/agnostic/point_in_poly_winding.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -30,15 +48,245 @@ namespace detail { namespace overlay
 
 
 
+// Index of the segments of a large ring in vertical stripes, to test many
+// points for being within that ring. Only the segments of the stripe of a
+// point are passed to the winding strategy: the other segments do not
+// contain the x-coordinate of the point and cannot change the result.
+// Because the strategy compares x-coordinates using an epsilon, the
+// segments are also added to the neighbouring stripes.
+// The index is built when a ring is tested for the second time.
+template <typename CoordinateType>
+class ring_stripes
+{
+public :
+    typedef CoordinateType coordinate_type;
+
+    // Minimum number of points of a ring to be indexed
+    static std::size_t const min_points = 64;
+
+    inline ring_stripes()
+        : m_min_x(0)
+        , m_width(0)
+        , m_test_count(0)
+    {}
+
+    inline bool empty() const
+    {
+        return m_offsets.empty();
+    }
+
+    template <typename Ring>
+    inline void update(Ring const& ring)
+    {
+        if (empty()
+            && ++m_test_count == 2
+            && boost::size(ring) >= min_points)
+        {
+            build(ring);
+        }
+    }
+
+    // Returns true if the point is within the ring (the same as
+    // geometry::within, using the winding strategy)
+    template <typename Point, typename Ring>
+    inline bool within(Point const& point, Ring const& ring) const
+    {
+        typedef strategy::within::winding
+            <
+                Point, typename geometry::point_type<Ring>::type
+            > strategy_type;
+
+        // The segments are visited in another order than by
+        // point_in_geometry, but in the same direction
+        bool const reversed
+            = geometry::point_order<Ring>::value == counterclockwise;
+
+        strategy_type strategy;
+        typename strategy_type::state_type state;
+
+        std::size_t const n = boost::size(ring);
+        std::size_t const s = stripe(get<0>(point));
+        for (std::size_t i = m_offsets[s]; i < m_offsets[s + 1]; i++)
+        {
+            std::size_t const a = m_segments[i];
+            std::size_t const b = a + 1 == n ? 0 : a + 1;
+            bool const proceed = reversed
+                ? strategy.apply(point, range::at(ring, b), range::at(ring, a), state)
+                : strategy.apply(point, range::at(ring, a), range::at(ring, b), state);
+            if (! proceed)
+            {
+                break;
+            }
+        }
+        return strategy.result(state) == 1;
+    }
+
+private :
+    // Average number of segments per stripe
+    static std::size_t const segments_per_stripe = 8;
+
+    inline std::size_t stripe(CoordinateType const& x) const
+    {
+        std::size_t const last = m_offsets.size() - 2;
+        if (! (x > m_min_x))
+        {
+            return 0;
+        }
+        CoordinateType const f = (x - m_min_x) / m_width;
+        return f < CoordinateType(last) ? static_cast<std::size_t>(f) : last;
+    }
+
+    template <typename Ring>
+    inline void build(Ring const& ring)
+    {
+        std::size_t const n = boost::size(ring);
+
+        CoordinateType min_x = get<0>(range::front(ring));
+        CoordinateType max_x = min_x;
+        for (std::size_t i = 1; i < n; i++)
+        {
+            CoordinateType const x = get<0>(range::at(ring, i));
+            if (x < min_x) { min_x = x; }
+            if (x > max_x) { max_x = x; }
+        }
+
+        std::size_t const stripe_count = n / segments_per_stripe;
+        CoordinateType const width = (max_x - min_x) / stripe_count;
+        CoordinateType const magnitude = (std::max)(CoordinateType(1),
+                (std::max)(math::abs(min_x), math::abs(max_x)));
+        if (! (width > magnitude * 1000
+                        * std::numeric_limits<CoordinateType>::epsilon()))
+        {
+            // Too narrow to distinguish stripes, the ring is not indexed
+            return;
+        }
+
+        m_min_x = min_x;
+        m_width = width;
+        m_offsets.assign(stripe_count + 1, 0);
+
+        // For a closed ring, the last segment ends at the last point,
+        // for an open ring it ends at the first point
+        std::size_t const segment_count
+            = geometry::closure<Ring>::value == closed ? n - 1 : n;
+
+        // Count the segments per stripe, then fill them (in order)
+        std::size_t total = 0;
+        for (std::size_t s = 0; s < segment_count; s++)
+        {
+            std::pair<std::size_t, std::size_t> const r = stripes_of(ring, s);
+            total += r.second - r.first + 1;
+            if (total > 4 * n)
+            {
+                // Many segments span many stripes, indexing does not help
+                m_offsets.clear();
+                return;
+            }
+            for (std::size_t k = r.first; k <= r.second; k++)
+            {
+                m_offsets[k + 1]++;
+            }
+        }
+        for (std::size_t k = 1; k <= stripe_count; k++)
+        {
+            m_offsets[k] += m_offsets[k - 1];
+        }
+
+        m_segments.resize(total);
+        std::vector<std::size_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+        for (std::size_t s = 0; s < segment_count; s++)
+        {
+            std::pair<std::size_t, std::size_t> const r = stripes_of(ring, s);
+            for (std::size_t k = r.first; k <= r.second; k++)
+            {
+                m_segments[fill[k]++] = s;
+            }
+        }
+    }
+
+    // Returns the first and last stripe of segment s, including the
+    // neighbouring stripes
+    template <typename Ring>
+    inline std::pair<std::size_t, std::size_t>
+        stripes_of(Ring const& ring, std::size_t s) const
+    {
+        std::size_t const n = boost::size(ring);
+        CoordinateType const x1 = get<0>(range::at(ring, s));
+        CoordinateType const x2 = get<0>(range::at(ring, s + 1 == n ? 0 : s + 1));
+        std::size_t const first = stripe((std::min)(x1, x2));
+        std::size_t const last = stripe((std::max)(x1, x2));
+        return std::make_pair(first > 0 ? first - 1 : first,
+                              (std::min)(last + 1, m_offsets.size() - 2));
+    }
+
+    CoordinateType m_min_x;
+    CoordinateType m_width;
+    std::size_t m_test_count;
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_segments;
+};
+
+
+template <typename Tag, bool Indexed>
+struct within_ring
+{
+    // Boxes, and rings which cannot be indexed, are tested as they are
+    template <typename Point, typename Geometry, typename Stripes>
+    static inline bool apply(Point const& point, Geometry const& geometry,
+                             Stripes& )
+    {
+        return geometry::within(point, geometry);
+    }
+};
+
+template <>
+struct within_ring<ring_tag, true>
+{
+    template <typename Point, typename Ring, typename Stripes>
+    static inline bool apply(Point const& point, Ring const& ring,
+                             Stripes& stripes)
+    {
+        stripes.update(ring);
+        return stripes.empty()
+            ? geometry::within(point, ring)
+            : stripes.within(point, ring);
+    }
+};
+
+// Only cartesian rings with floating point coordinates are indexed
+template <typename Point, typename Ring, typename Stripes>
+inline bool within_ring_of(Point const& point, Ring const& ring, Stripes& stripes)
+{
+    static const bool indexed
+        = boost::is_same
+            <
+                typename geometry::cs_tag<Ring>::type, cartesian_tag
+            >::value
+        && boost::is_floating_point
+            <
+                typename geometry::coordinate_type<Ring>::type
+            >::value
+        && boost::is_floating_point
+            <
+                typename Stripes::coordinate_type
+            >::value;
+
+    return within_ring
+        <
+            typename geometry::tag<Ring>::type, indexed
+        >::apply(point, ring, stripes);
+}
+
 template
 <
     typename Item,
     typename Geometry1, typename Geometry2,
-    typename RingCollection
+    typename RingCollection,
+    typename Stripes
 >
 static inline bool within_selected_input(Item const& item2, ring_identifier const& ring_id,
         Geometry1 const& geometry1, Geometry2 const& geometry2,
-        RingCollection const& collection)
+        RingCollection const& collection, Stripes& stripes)
 {
     typedef typename geometry::tag<Geometry1>::type tag1;
     typedef typename geometry::tag<Geometry2>::type tag2;
@@ -46,17 +294,14 @@ static inline bool within_selected_input(Item const& item2, ring_identifier cons
     switch (ring_id.source_index)
     {
         case 0 :
-            return geometry::within(item2.point,
-                get_ring<tag1>::apply(ring_id, geometry1));
-            break;
+            return within_ring_of(item2.point,
+                get_ring<tag1>::apply(ring_id, geometry1), stripes);
         case 1 :
-            return geometry::within(item2.point,
-                get_ring<tag2>::apply(ring_id, geometry2));
-            break;
+            return within_ring_of(item2.point,
+                get_ring<tag2>::apply(ring_id, geometry2), stripes);
         case 2 :
-            return geometry::within(item2.point,
-                get_ring<void>::apply(ring_id, collection));
-            break;
+            return within_ring_of(item2.point,
+                get_ring<void>::apply(ring_id, collection), stripes);
     }
     return false;
 }
@@ -66,6 +311,7 @@ template <typename Point>
 struct ring_info_helper
 {
     typedef typename geometry::default_area_result<Point>::type area_type;
+    typedef model::box<Point> box_type;
 
     ring_identifier id;
     area_type real_area;
@@ -100,60 +346,142 @@ struct ring_info_helper_ovelaps_box
     }
 };
 
-template <typename Geometry1, typename Geometry2, typename Collection, typename RingMap>
-struct assign_visitor
+// Collects, for pairs of rings with overlapping envelopes, the candidate
+// parent (the larger ring, or the first of two equal rings) of the other
+// ring, if the point of that ring is within its envelope
+template <typename RingMap, typename Helpers>
+struct candidate_visitor
 {
-    typedef typename RingMap::mapped_type ring_info_type;
-
-    Geometry1 const& m_geometry1;
-    Geometry2 const& m_geometry2;
-    Collection const& m_collection;
     RingMap& m_ring_map;
+    Helpers const& m_helpers;
     bool m_check_for_orientation;
+    std::vector<std::pair<std::size_t, std::size_t> > m_candidates;
 
-
-    inline assign_visitor(Geometry1 const& g1, Geometry2 const& g2, Collection const& c,
-                RingMap& map, bool check)
-        : m_geometry1(g1)
-        , m_geometry2(g2)
-        , m_collection(c)
-        , m_ring_map(map)
+    inline candidate_visitor(RingMap& map, Helpers const& helpers, bool check)
+        : m_ring_map(map)
+        , m_helpers(helpers)
         , m_check_for_orientation(check)
     {}
 
     template <typename Item>
-    inline void apply(Item const& outer, Item const& inner, bool first = true)
+    inline bool apply(Item const& item1, Item const& item2)
     {
-        if (first && outer.abs_area < inner.abs_area)
-        {
-            // Apply with reversed arguments
-            apply(inner, outer, false);
-            return;
-        }
+        // Partition passes the items of the (contiguous) helper vector
+        std::size_t const index1 = &item1 - &m_helpers[0];
+        std::size_t const index2 = &item2 - &m_helpers[0];
+        bool const first_is_outer = item2.abs_area < item1.abs_area
+            || (! (item1.abs_area < item2.abs_area) && index1 < index2);
+
+        Item const& outer = first_is_outer ? item1 : item2;
+        Item const& inner = first_is_outer ? item2 : item1;
 
         if (m_check_for_orientation
          || (math::larger(outer.real_area, 0)
           && math::smaller(inner.real_area, 0)))
         {
-            ring_info_type& inner_in_map = m_ring_map[inner.id];
-
-            if (geometry::within(inner_in_map.point, outer.envelope)
-               && within_selected_input(inner_in_map, outer.id, m_geometry1, m_geometry2, m_collection)
-               )
+            if (geometry::within(m_ring_map[inner.id].point, outer.envelope))
             {
-                // Assign a parent if there was no earlier parent, or the newly
-                // found parent is smaller than the previous one
-                if (inner_in_map.parent.source_index == -1
-                    || outer.abs_area < inner_in_map.parent_area)
-                {
-                    inner_in_map.parent = outer.id;
-                    inner_in_map.parent_area = outer.abs_area;
-                }
+                m_candidates.push_back(first_is_outer
+                    ? std::make_pair(index2, index1)
+                    : std::make_pair(index1, index2));
             }
         }
+
+        return true;
     }
 };
 
+// Ordering candidates per inner ring, and then on the area of the parent
+template <typename Helpers>
+struct less_by_parent_area
+{
+    Helpers const& m_helpers;
+
+    explicit inline less_by_parent_area(Helpers const& helpers)
+        : m_helpers(helpers)
+    {}
+
+    inline bool operator()(std::pair<std::size_t, std::size_t> const& left,
+                           std::pair<std::size_t, std::size_t> const& right) const
+    {
+        if (left.first != right.first)
+        {
+            return left.first < right.first;
+        }
+        if (m_helpers[left.second].abs_area < m_helpers[right.second].abs_area
+            || m_helpers[right.second].abs_area < m_helpers[left.second].abs_area)
+        {
+            return m_helpers[left.second].abs_area
+                < m_helpers[right.second].abs_area;
+        }
+        return left.second < right.second;
+    }
+};
+
+// Assigns the parents of the rings. Candidate parents are found using
+// partition over the envelopes, and sorted by area. Per ring they are tested
+// (the smallest first) until the first ring containing it, which is the
+// parent. Large candidates, tested for many rings, are indexed
+// (see ring_stripes).
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename RingCollection,
+    typename RingMap,
+    typename Helpers
+>
+inline void assign_parent_rings(Geometry1 const& geometry1,
+        Geometry2 const& geometry2,
+        RingCollection const& collection,
+        RingMap& ring_map,
+        Helpers const& helpers,
+        bool check_for_orientation)
+{
+    typedef typename boost::range_value<Helpers>::type helper_type;
+    typedef typename helper_type::box_type box_type;
+    typedef typename RingMap::mapped_type ring_info_type;
+    typedef typename geometry::coordinate_type
+        <
+            typename ring_info_type::point_type
+        >::type coordinate_type;
+
+    candidate_visitor<RingMap, Helpers> visitor(ring_map, helpers,
+                                                check_for_orientation);
+
+    geometry::partition
+        <
+            box_type, ring_info_helper_get_box, ring_info_helper_ovelaps_box
+        >::apply(helpers, visitor);
+
+    std::vector<std::pair<std::size_t, std::size_t> >& candidates
+        = visitor.m_candidates;
+    std::sort(candidates.begin(), candidates.end(),
+              less_by_parent_area<Helpers>(helpers));
+
+    std::vector<ring_stripes<coordinate_type> > stripes(boost::size(helpers));
+
+    for (std::size_t i = 0; i < candidates.size(); i++)
+    {
+        ring_info_type& inner_in_map = ring_map[helpers[candidates[i].first].id];
+        if (inner_in_map.parent.source_index >= 0)
+        {
+            // The parent is already found (the smallest candidate)
+            continue;
+        }
+
+        helper_type const& outer = helpers[candidates[i].second];
+
+        if (within_selected_input(inner_in_map, outer.id,
+                geometry1, geometry2, collection,
+                stripes[candidates[i].second]))
+        {
+            inner_in_map.parent = outer.id;
+            inner_in_map.parent_area = outer.abs_area;
+        }
+    }
+}
+
+
 
 
 
@@ -174,7 +502,6 @@ inline void assign_parents(Geometry1 const& geometry1,
 
     typedef typename RingMap::mapped_type ring_info_type;
     typedef typename ring_info_type::point_type point_type;
-    typedef model::box<point_type> box_type;
 
     typedef typename RingMap::iterator map_iterator_type;
 
@@ -250,16 +577,8 @@ inline void assign_parents(Geometry1 const& geometry1,
             }
         }
 
-        assign_visitor
-            <
-                Geometry1, Geometry2,
-                RingCollection, RingMap
-            > visitor(geometry1, geometry2, collection, ring_map, check_for_orientation);
-
-        geometry::partition
-            <
-                box_type, ring_info_helper_get_box, ring_info_helper_ovelaps_box
-            >::apply(vector, visitor);
+        assign_parent_rings(geometry1, geometry2, collection, ring_map, vector,
+                            check_for_orientation);
     }
 
     if (check_for_orientation)
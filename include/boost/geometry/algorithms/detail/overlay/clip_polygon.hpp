@@ -0,0 +1,1044 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+
+// Position of a point on the border of a box, ordered clockwise, starting
+// at the lower left corner. Side 0 is the left side, going up, side 1 the
+// top side, side 2 the right side and side 3 the bottom side. The value is
+// the coordinate along the side, negated for sides 2 and 3, such that it
+// increases in clockwise direction (negation is exact).
+template <typename CoordinateType>
+struct box_border_position
+{
+    int side;
+    CoordinateType value;
+
+    inline bool operator<(box_border_position const& other) const
+    {
+        return side < other.side
+            || (side == other.side && value < other.value);
+    }
+};
+
+
+/*!
+\brief Clips the rings of an areal geometry with a box
+\details The rings are walked in clockwise order. The parts of a ring
+    inside the (closed) box are collected as pieces, which start and end
+    at the border of the box. Pieces are linked into closed rings by
+    walking clockwise along the border of the box, from the end of a piece
+    to the start of the next one, adding the corners passed. This is
+    correct for valid input and avoids all turn calculations.
+    Coordinates of entry and exit points are snapped exactly to the border,
+    such that the positions on the border can be compared exactly.
+    Pieces lying completely on the border of the box do not contribute to
+    the area and are discarded. Pieces are split where the ring touches
+    the border from inside at a reflex vertex, and rings inside the box
+    touching the border in more than one vertex are walked as pieces, such
+    that output rings do not touch themselves. Vertices on the border
+    between two neighbours on the same side (collinear, or spikes where
+    pieces meet) are removed. Output rings without area are discarded.
+\note Only for 2D cartesian coordinates
+*/
+template <typename Box, typename Point>
+class areal_box_clipper
+{
+public :
+    typedef model::ring<Point, true, false> ring_type;
+
+    enum ring_relation
+    {
+        ring_outside,
+        ring_inside,
+        ring_contains_box,
+        ring_crosses
+    };
+
+    inline areal_box_clipper(Box const& box)
+    {
+        m_min_x = geometry::get<min_corner, 0>(box);
+        m_min_y = geometry::get<min_corner, 1>(box);
+        m_max_x = geometry::get<max_corner, 0>(box);
+        m_max_y = geometry::get<max_corner, 1>(box);
+    }
+
+    inline bool is_degenerate() const
+    {
+        return ! (m_min_x < m_max_x && m_min_y < m_max_y);
+    }
+
+    inline bool has_pieces() const
+    {
+        return ! m_piece_begin.empty();
+    }
+
+    //! Adds the parts of the ring inside the box as pieces. If it has no
+    //! parts, the relation of the ring with the box is returned
+    template <typename Ring>
+    inline ring_relation add_ring(Ring const& ring)
+    {
+        detail::normalized_view<Ring const> view(ring);
+
+        // The view is closed, the last point is not visited separately
+        std::size_t const size = boost::size(view);
+        if (size < 4)
+        {
+            return ring_outside;
+        }
+        std::size_t const n = size - 1;
+
+        // Start at a vertex outside the box, such that pieces always start
+        // and end at the border
+        std::size_t start = 0;
+        std::size_t border_start = n;
+        std::size_t border_count = 0;
+        Point p;
+        for ( ; start < n; start++)
+        {
+            geometry::convert(range::at(view, start), p);
+            if (! is_covered(p))
+            {
+                break;
+            }
+            // Count distinct vertices, the ring can have duplicate points
+            if (on_border(p)
+                && (border_count == 0
+                    || ! (geometry::detail::equals::equals_point_point(p,
+                                range::at(view, border_start))
+                          || geometry::detail::equals::equals_point_point(p,
+                                range::front(view)))))
+            {
+                border_start = start;
+                border_count++;
+            }
+        }
+
+        if (start == n)
+        {
+            // A ring inside the box, touching the border in more than one
+            // vertex, splits the interior (a hole) or touches itself
+            // after linking. It is walked as a piece from the border
+            if (border_count < 2)
+            {
+                return ring_inside;
+            }
+            start = border_start;
+            geometry::convert(range::at(view, start), p);
+        }
+        Point const start_point = p;
+
+        std::size_t const piece_count = m_piece_begin.size();
+        std::vector<Point>& piece = m_current;
+        piece.clear();
+
+        for (std::size_t k = 0; k < n; k++)
+        {
+            std::size_t const i = (start + k) % n;
+            Point q;
+            geometry::convert(range::at(view, (i + 1) % n), q);
+
+            Point entry, exit;
+            bool entered = false, exited = false;
+            if (! clip_segment(p, q, entry, exit, entered, exited))
+            {
+                finish_piece();
+            }
+            else
+            {
+                if (entered)
+                {
+                    finish_piece();
+                    piece.push_back(entry);
+                }
+                else if (piece.empty())
+                {
+                    // First point is located on the border
+                    piece.push_back(p);
+                }
+
+                if (exited)
+                {
+                    push_no_duplicates(piece, exit);
+                    finish_piece();
+                }
+                else
+                {
+                    push_no_duplicates(piece, q);
+                }
+            }
+            p = q;
+        }
+        finish_piece();
+
+        if (m_piece_begin.size() > piece_count + 1
+            && on_border(start_point))
+        {
+            // The ring is walked from a vertex on the border. If it touches
+            // the border there, the first piece is split off from the last
+            std::size_t const last = m_piece_begin.size() - 1;
+            Point const& last_end = m_pieces[m_pieces.size() - 1];
+            if (geometry::detail::equals::equals_point_point(last_end,
+                        start_point)
+                && geometry::detail::equals::equals_point_point(
+                        m_pieces[m_piece_begin[piece_count]], start_point)
+                && turns_left(m_pieces[m_pieces.size() - 2], start_point,
+                        m_pieces[m_piece_begin[piece_count] + 1]))
+            {
+                m_piece_previous[piece_count] = last;
+            }
+        }
+
+        if (m_piece_begin.size() > piece_count)
+        {
+            return ring_crosses;
+        }
+
+        // The ring does not enter the interior of the box, so the center
+        // of the box is either inside or outside of it. The center is
+        // calculated in floating point, such that for integer coordinates
+        // it is not truncated onto the border or onto a vertex of the ring
+        model::point<calculation_type, 2, cs::cartesian> center;
+        geometry::set<0>(center, calculation_type(m_min_x)
+            + (calculation_type(m_max_x) - calculation_type(m_min_x)) / 2);
+        geometry::set<1>(center, calculation_type(m_min_y)
+            + (calculation_type(m_max_y) - calculation_type(m_min_y)) / 2);
+        return detail::within::point_in_geometry(center, ring) > 0
+            ? ring_contains_box : ring_outside;
+    }
+
+    //! Links the pieces into closed rings, which are appended
+    inline void link(std::vector<ring_type>& rings) const
+    {
+        std::size_t const count = m_piece_begin.size();
+
+        std::vector<std::pair<position_type, std::size_t> > starts;
+        starts.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            starts.push_back(std::make_pair(
+                position(m_pieces[m_piece_begin[i]]), i));
+        }
+        std::sort(starts.begin(), starts.end(), less_by_position());
+
+        std::vector<bool> used(count, false);
+        for (std::size_t s = 0; s < count; s++)
+        {
+            std::size_t const first = starts[s].second;
+            if (used[first])
+            {
+                continue;
+            }
+
+            ring_type ring;
+            std::size_t current = first;
+            for (std::size_t guard = 0; guard <= count; guard++)
+            {
+                used[current] = true;
+                for (std::size_t j = m_piece_begin[current];
+                     j < piece_end(current); j++)
+                {
+                    push_no_duplicates(ring, m_pieces[j]);
+                }
+
+                position_type const end
+                    = position(m_pieces[piece_end(current) - 1]);
+                std::size_t const next
+                    = find_next(starts, used, end, first, current);
+                add_corners(ring, end, starts[next].first);
+
+                if (starts[next].second == first)
+                {
+                    break;
+                }
+                current = starts[next].second;
+            }
+
+            if (boost::size(ring) > 1
+                && geometry::detail::equals::equals_point_point(range::front(ring),
+                        range::back(ring)))
+            {
+                range::pop_back(ring);
+            }
+
+            remove_border_spikes(ring);
+
+            if (boost::size(ring) >= 3 && signed_area(ring) < 0)
+            {
+                rings.push_back(ring);
+            }
+        }
+    }
+
+    //! Appends a copy of the ring, which is inside the box, normalized
+    template <typename Ring>
+    static inline void copy_ring(Ring const& ring, ring_type& result)
+    {
+        detail::normalized_view<Ring const> view(ring);
+        std::size_t const size = boost::size(view);
+        for (std::size_t i = 0; i + 1 < size; i++)
+        {
+            Point p;
+            geometry::convert(range::at(view, i), p);
+            range::push_back(result, p);
+        }
+    }
+
+    inline void box_ring(ring_type& result) const
+    {
+        for (int side = 0; side < 4; side++)
+        {
+            range::push_back(result, corner(side));
+        }
+    }
+
+private :
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    typedef box_border_position<coordinate_type> position_type;
+
+    struct less_by_position
+    {
+        template <typename T>
+        inline bool operator()(T const& left, T const& right) const
+        {
+            return left.first < right.first;
+        }
+    };
+
+    template <typename Range>
+    static inline void push_no_duplicates(Range& range, Point const& point)
+    {
+        if (boost::empty(range)
+            || ! geometry::detail::equals::equals_point_point(range::back(range), point))
+        {
+            range::push_back(range, point);
+        }
+    }
+
+    inline bool is_covered(Point const& p) const
+    {
+        coordinate_type const x = geometry::get<0>(p);
+        coordinate_type const y = geometry::get<1>(p);
+        return x >= m_min_x && x <= m_max_x && y >= m_min_y && y <= m_max_y;
+    }
+
+    inline position_type position(Point const& p) const
+    {
+        coordinate_type const x = geometry::get<0>(p);
+        coordinate_type const y = geometry::get<1>(p);
+
+        position_type result;
+        if (x == m_min_x && y != m_max_y)
+        {
+            result.side = 0;
+            result.value = y;
+        }
+        else if (y == m_max_y && x != m_max_x)
+        {
+            result.side = 1;
+            result.value = x;
+        }
+        else if (x == m_max_x && y != m_min_y)
+        {
+            result.side = 2;
+            result.value = -y;
+        }
+        else
+        {
+            result.side = 3;
+            result.value = -x;
+        }
+        return result;
+    }
+
+    inline Point corner(int side) const
+    {
+        Point result;
+        geometry::set<0>(result, side < 2 ? m_min_x : m_max_x);
+        geometry::set<1>(result, side == 0 || side == 3 ? m_min_y : m_max_y);
+        return result;
+    }
+
+    inline std::size_t piece_end(std::size_t index) const
+    {
+        return index + 1 < m_piece_begin.size()
+            ? m_piece_begin[index + 1] : m_pieces.size();
+    }
+
+    // Returns the index (in starts) of the first piece, starting at or
+    // after the specified position in clockwise order, which is not yet
+    // used (or which is the first piece of the current ring).
+    // The piece split off from the current piece, at a vertex where the
+    // ring touches the border from inside, is skipped (unless it is the
+    // first piece): the interior is on the other side of that vertex.
+    template <typename Starts>
+    inline std::size_t find_next(Starts const& starts,
+            std::vector<bool> const& used,
+            position_type const& position, std::size_t first,
+            std::size_t current) const
+    {
+        std::size_t const count = starts.size();
+        std::size_t index = static_cast<std::size_t>(
+            std::lower_bound(starts.begin(), starts.end(),
+                std::make_pair(position, std::size_t()), less_by_position())
+            - starts.begin());
+
+        for (std::size_t i = 0; i < count; i++, index++)
+        {
+            std::size_t const candidate = index % count;
+            std::size_t const piece = starts[candidate].second;
+            if (piece == first)
+            {
+                return candidate;
+            }
+            if (! used[piece]
+                && m_piece_previous[piece] != current)
+            {
+                return candidate;
+            }
+        }
+        return index % count;
+    }
+
+    // Adds the corners passed walking clockwise from one position to another
+    inline void add_corners(ring_type& ring, position_type const& from,
+                position_type const& to) const
+    {
+        int count = (to.side - from.side + 4) % 4;
+        if (count == 0 && to < from)
+        {
+            count = 4;
+        }
+        for (int i = 1; i <= count; i++)
+        {
+            push_no_duplicates(ring,
+                corner((from.side + i) % 4));
+        }
+    }
+
+    inline bool on_same_side(Point const& a, Point const& b) const
+    {
+        coordinate_type const ax = geometry::get<0>(a);
+        coordinate_type const ay = geometry::get<1>(a);
+        coordinate_type const bx = geometry::get<0>(b);
+        coordinate_type const by = geometry::get<1>(b);
+        return (ax == m_min_x && bx == m_min_x)
+            || (ax == m_max_x && bx == m_max_x)
+            || (ay == m_min_y && by == m_min_y)
+            || (ay == m_max_y && by == m_max_y);
+    }
+
+    inline bool on_same_line(Point const& a, Point const& b,
+                Point const& c) const
+    {
+        coordinate_type const ax = geometry::get<0>(a);
+        coordinate_type const ay = geometry::get<1>(a);
+        coordinate_type const bx = geometry::get<0>(b);
+        coordinate_type const by = geometry::get<1>(b);
+        coordinate_type const cx = geometry::get<0>(c);
+        coordinate_type const cy = geometry::get<1>(c);
+        return (ax == m_min_x && bx == m_min_x && cx == m_min_x)
+            || (ax == m_max_x && bx == m_max_x && cx == m_max_x)
+            || (ay == m_min_y && by == m_min_y && cy == m_min_y)
+            || (ay == m_max_y && by == m_max_y && cy == m_max_y);
+    }
+
+    inline bool on_border(Point const& p) const
+    {
+        coordinate_type const x = geometry::get<0>(p);
+        coordinate_type const y = geometry::get<1>(p);
+        return x == m_min_x || x == m_max_x || y == m_min_y || y == m_max_y;
+    }
+
+    // Returns true if the ring turns left at b, for a clockwise ring this
+    // is a reflex vertex
+    static inline bool turns_left(Point const& a, Point const& b,
+                Point const& c)
+    {
+        calculation_type const bx = geometry::get<0>(b);
+        calculation_type const by = geometry::get<1>(b);
+        return (bx - geometry::get<0>(a)) * (geometry::get<1>(c) - by)
+             - (by - geometry::get<1>(a)) * (geometry::get<0>(c) - bx) > 0;
+    }
+
+    // Removes vertices lying on the border between two neighbours on the
+    // same side of the box. They are collinear, or the ring goes back
+    // along the border (a spike), which happens where two pieces meet
+    // on the border.
+    inline void remove_border_spikes(ring_type& ring) const
+    {
+        if (boost::size(ring) < 3)
+        {
+            return;
+        }
+
+        ring_type result;
+        for (std::size_t i = 0; i < boost::size(ring); i++)
+        {
+            range::push_back(result, range::at(ring, i));
+            std::size_t n = boost::size(result);
+            while (n >= 3 && on_same_line(range::at(result, n - 3),
+                        range::at(result, n - 2), range::at(result, n - 1)))
+            {
+                range::at(result, n - 2) = range::at(result, n - 1);
+                range::pop_back(result);
+                n--;
+            }
+        }
+
+        // Handle the closing vertices
+        std::size_t first = 0;
+        bool changed = true;
+        while (changed && boost::size(result) - first >= 3)
+        {
+            std::size_t const n = boost::size(result);
+            changed = false;
+            if (on_same_line(range::at(result, n - 2),
+                    range::at(result, n - 1), range::at(result, first)))
+            {
+                range::pop_back(result);
+                changed = true;
+            }
+            else if (on_same_line(range::at(result, n - 1),
+                    range::at(result, first), range::at(result, first + 1)))
+            {
+                first++;
+                changed = true;
+            }
+        }
+
+        ring.clear();
+        std::copy(boost::begin(result) + first, boost::end(result),
+                  range::back_inserter(ring));
+    }
+
+    // Stores the part [begin, end) of the current piece, returns true
+    // if it is stored
+    inline bool store_piece(std::size_t begin, std::size_t end,
+                bool split)
+    {
+        // Pieces going along the border only, or touching it in one point,
+        // don't enclose any area. They are not stored, the walk along the
+        // border takes care of them.
+        bool along_border = true;
+        for (std::size_t i = begin + 1; along_border && i < end; i++)
+        {
+            along_border = on_same_side(m_current[i - 1], m_current[i]);
+        }
+
+        if (along_border)
+        {
+            return false;
+        }
+
+        m_piece_begin.push_back(m_pieces.size());
+        std::size_t const index = m_piece_begin.size() - 1;
+        m_piece_previous.push_back(split ? index - 1 : index);
+        m_pieces.insert(m_pieces.end(), m_current.begin() + begin,
+                        m_current.begin() + end);
+        return true;
+    }
+
+    inline void finish_piece()
+    {
+        if (m_current.empty())
+        {
+            return;
+        }
+
+        // A piece touching the border at a reflex vertex has the interior
+        // of the polygon on both sides of that vertex, along the border.
+        // It is split there, such that the linked rings do not touch
+        // themselves. Parts going counterclockwise along the border are
+        // separated in this way and not stored.
+        std::size_t begin = 0;
+        bool split = false;
+        for (std::size_t i = 1; i + 1 < m_current.size(); i++)
+        {
+            if (on_border(m_current[i])
+                && turns_left(m_current[i - 1], m_current[i], m_current[i + 1]))
+            {
+                split = store_piece(begin, i + 1, split);
+                begin = i;
+            }
+        }
+        store_piece(begin, m_current.size(), split);
+        m_current.clear();
+    }
+
+    template <typename T>
+    static inline bool check_edge(T const& p, T const& q, T& t1, T& t2,
+                int side, int& side1, int& side2)
+    {
+        if (p < 0)
+        {
+            T const r = q / p;
+            if (r > t2)
+            {
+                return false;
+            }
+            if (r > t1)
+            {
+                t1 = r;
+                side1 = side;
+            }
+        }
+        else if (p > 0)
+        {
+            T const r = q / p;
+            if (r < t1)
+            {
+                return false;
+            }
+            if (r < t2)
+            {
+                t2 = r;
+                side2 = side;
+            }
+        }
+        else if (q < 0)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // Returns the value kept within [min, max], or exactly min or max
+    // if it is (approximately) equal to it
+    template <typename Policy>
+    static inline coordinate_type snap_to_range(coordinate_type const& value,
+                coordinate_type const& min_value,
+                coordinate_type const& max_value,
+                Policy const& policy)
+    {
+        if (! (value > min_value)
+            || math::detail::equals_by_policy(value, min_value, policy))
+        {
+            return min_value;
+        }
+        if (! (value < max_value)
+            || math::detail::equals_by_policy(value, max_value, policy))
+        {
+            return max_value;
+        }
+        return value;
+    }
+
+    template <typename Policy>
+    inline void snap(Point& point, int side, Policy const& policy) const
+    {
+        // Set the coordinate exactly on the side, and keep the other
+        // coordinate within the box. A segment going through a corner
+        // is snapped to that corner, to avoid a spike of almost zero
+        // length along the other side
+        if (side == 0 || side == 2)
+        {
+            geometry::set<0>(point, side == 0 ? m_min_x : m_max_x);
+            geometry::set<1>(point, snap_to_range(geometry::get<1>(point),
+                m_min_y, m_max_y, policy));
+        }
+        else
+        {
+            geometry::set<1>(point, side == 1 ? m_max_y : m_min_y);
+            geometry::set<0>(point, snap_to_range(geometry::get<0>(point),
+                m_min_x, m_max_x, policy));
+        }
+    }
+
+    // Liang-Barsky, also reporting the side where the segment enters
+    // and leaves the box
+    inline bool clip_segment(Point const& p, Point const& q,
+                Point& entry, Point& exit,
+                bool& entered, bool& exited) const
+    {
+        calculation_type const px = geometry::get<0>(p);
+        calculation_type const py = geometry::get<1>(p);
+        calculation_type const dx = calculation_type(geometry::get<0>(q)) - px;
+        calculation_type const dy = calculation_type(geometry::get<1>(q)) - py;
+
+        calculation_type t1 = 0;
+        calculation_type t2 = 1;
+        int side1 = -1, side2 = -1;
+
+        if (! (check_edge(-dx, px - m_min_x, t1, t2, 0, side1, side2)
+            && check_edge(dx, m_max_x - px, t1, t2, 2, side1, side2)
+            && check_edge(-dy, py - m_min_y, t1, t2, 3, side1, side2)
+            && check_edge(dy, m_max_y - py, t1, t2, 1, side1, side2)))
+        {
+            return false;
+        }
+
+        entered = t1 > 0;
+        exited = t2 < 1;
+
+        // The calculated coordinates are precise to a few units in the
+        // last place, relative to the coordinates of the segment
+        calculation_type const qx = geometry::get<0>(q);
+        calculation_type const qy = geometry::get<1>(q);
+        math::detail::equals_factor_policy<calculation_type> const policy(
+            4 * math::detail::greatest(math::abs(px), math::abs(py),
+                                       math::abs(qx), math::abs(qy)));
+        if (entered)
+        {
+            geometry::set<0>(entry, px + t1 * dx);
+            geometry::set<1>(entry, py + t1 * dy);
+            snap(entry, side1, policy);
+        }
+        if (exited)
+        {
+            geometry::set<0>(exit, px + t2 * dx);
+            geometry::set<1>(exit, py + t2 * dy);
+            snap(exit, side2, policy);
+        }
+        return true;
+    }
+
+    static inline calculation_type signed_area(ring_type const& ring)
+    {
+        calculation_type sum = 0;
+        std::size_t const n = boost::size(ring);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            Point const& a = range::at(ring, i);
+            Point const& b = range::at(ring, (i + 1) % n);
+            sum += calculation_type(geometry::get<0>(a)) * geometry::get<1>(b)
+                 - calculation_type(geometry::get<0>(b)) * geometry::get<1>(a);
+        }
+        // Positive for counter clockwise rings
+        return math::equals(sum, calculation_type()) ? 0 : sum / 2;
+    }
+
+    coordinate_type m_min_x, m_min_y, m_max_x, m_max_y;
+
+    // All pieces, stored consecutively, and the index of the first
+    // point of each piece
+    std::vector<Point> m_pieces;
+    std::vector<std::size_t> m_piece_begin;
+    // For each piece, the piece it is split off from, or itself
+    std::vector<std::size_t> m_piece_previous;
+    std::vector<Point> m_current;
+};
+
+
+template <typename Ring, typename Clipper, typename Rings>
+inline void clip_ring_with_box(Ring const& ring, Clipper& clipper,
+            Rings& outer_rings)
+{
+    typename Clipper::ring_type copy;
+    switch (clipper.add_ring(ring))
+    {
+        case Clipper::ring_inside :
+            Clipper::copy_ring(ring, copy);
+            outer_rings.push_back(copy);
+            break;
+        case Clipper::ring_contains_box :
+            clipper.box_ring(copy);
+            outer_rings.push_back(copy);
+            break;
+        default :
+            break;
+    }
+}
+
+
+template <typename Polygon, typename Clipper, typename Rings>
+inline void clip_polygon_with_box(Polygon const& polygon, Clipper& clipper,
+            Rings& outer_rings, Rings& inner_rings)
+{
+    typedef typename Clipper::ring_type ring_type;
+
+    typename Clipper::ring_relation const outer_relation
+        = clipper.add_ring(geometry::exterior_ring(polygon));
+    if (outer_relation == Clipper::ring_outside)
+    {
+        return;
+    }
+
+    std::size_t const inner_count = inner_rings.size();
+    typename interior_return_type<Polygon const>::type
+        rings = geometry::interior_rings(polygon);
+    for (typename detail::interior_iterator<Polygon const>::type
+            it = boost::begin(rings); it != boost::end(rings); ++it)
+    {
+        switch (clipper.add_ring(*it))
+        {
+            case Clipper::ring_inside :
+                inner_rings.push_back(ring_type());
+                Clipper::copy_ring(*it, inner_rings.back());
+                break;
+            case Clipper::ring_contains_box :
+                // The box is inside a hole, the result is empty.
+                // Any pieces are outside the hole, so there are none.
+                inner_rings.resize(inner_count);
+                return;
+            default :
+                break;
+        }
+    }
+
+    if (outer_relation == Clipper::ring_inside)
+    {
+        outer_rings.push_back(ring_type());
+        Clipper::copy_ring(geometry::exterior_ring(polygon), outer_rings.back());
+    }
+    else if (outer_relation == Clipper::ring_contains_box
+             && ! clipper.has_pieces())
+    {
+        outer_rings.push_back(ring_type());
+        clipper.box_ring(outer_rings.back());
+    }
+    // Else the outer ring (or a hole) crosses the border, the rings are
+    // created by linking the pieces
+}
+
+
+template <typename Tag>
+struct clip_areal_with_box
+{};
+
+template <>
+struct clip_areal_with_box<ring_tag>
+{
+    template <typename Ring, typename Clipper, typename Rings>
+    static inline void apply(Ring const& ring, Clipper& clipper,
+                Rings& outer_rings, Rings& )
+    {
+        clip_ring_with_box(ring, clipper, outer_rings);
+    }
+};
+
+template <>
+struct clip_areal_with_box<polygon_tag>
+{
+    template <typename Polygon, typename Clipper, typename Rings>
+    static inline void apply(Polygon const& polygon, Clipper& clipper,
+                Rings& outer_rings, Rings& inner_rings)
+    {
+        clip_polygon_with_box(polygon, clipper, outer_rings, inner_rings);
+    }
+};
+
+template <>
+struct clip_areal_with_box<multi_polygon_tag>
+{
+    template <typename MultiPolygon, typename Clipper, typename Rings>
+    static inline void apply(MultiPolygon const& multi, Clipper& clipper,
+                Rings& outer_rings, Rings& inner_rings)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            clip_polygon_with_box(*it, clipper, outer_rings, inner_rings);
+        }
+    }
+};
+
+
+template <bool Reverse, bool Close, typename Ring, typename RingOut>
+inline void convert_clipped_ring(Ring const& ring, RingOut& ring_out)
+{
+    if (Reverse)
+    {
+        std::copy(boost::rbegin(ring), boost::rend(ring),
+                  range::back_inserter(ring_out));
+    }
+    else
+    {
+        std::copy(boost::begin(ring), boost::end(ring),
+                  range::back_inserter(ring_out));
+    }
+    if (Close)
+    {
+        range::push_back(ring_out, range::front(ring_out));
+    }
+}
+
+
+// Returns true if the intersection of the areal geometry with the box,
+// resulting in polygons, can be calculated by intersection_areal_box
+template <typename Areal, typename Box, typename GeometryOut>
+struct is_areal_box_clip
+    : boost::mpl::bool_
+        <
+            boost::is_same<typename tag<Box>::type, box_tag>::value
+            && ! boost::is_same<typename tag<Areal>::type, box_tag>::value
+            && boost::is_same<typename tag<GeometryOut>::type, polygon_tag>::value
+            && boost::is_same
+                <
+                    typename geometry::cs_tag<Areal>::type,
+                    cartesian_tag
+                >::value
+            && geometry::dimension<Areal>::value == 2
+        >
+{};
+
+
+/*!
+\brief Intersection of an areal geometry (ring, polygon, multi-polygon)
+    with a box, resulting in polygons, without calculating turns
+\note Only for 2D cartesian coordinates, the areal geometry should be valid
+*/
+template <typename Areal, typename Box, typename PolygonOut>
+struct intersection_areal_box
+{
+    template <typename RobustPolicy, typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply(Areal const& areal, Box const& box,
+                RobustPolicy const& ,
+                OutputIterator out,
+                Strategy const& )
+    {
+        typedef typename geometry::point_type<PolygonOut>::type point_type;
+        typedef areal_box_clipper<Box, point_type> clipper_type;
+        typedef typename clipper_type::ring_type ring_type;
+
+        static bool const reverse
+            = geometry::point_order<PolygonOut>::value == counterclockwise;
+        static bool const close
+            = geometry::closure<PolygonOut>::value == closed;
+
+        clipper_type clipper(box);
+        if (clipper.is_degenerate())
+        {
+            return out;
+        }
+
+        std::vector<ring_type> outer_rings, inner_rings;
+        clip_areal_with_box
+            <
+                typename tag<Areal>::type
+            >::apply(areal, clipper, outer_rings, inner_rings);
+
+        clipper.link(outer_rings);
+
+        if (outer_rings.empty())
+        {
+            return out;
+        }
+
+        // Assign holes (which are completely inside the box) to the
+        // smallest outer ring containing them. Outer rings can be nested
+        // (an island in a lake in an island), so the outer rings are
+        // visited in ascending order of their area
+        std::vector<std::size_t> parents(inner_rings.size(), 0);
+        if (outer_rings.size() > 1 && ! inner_rings.empty())
+        {
+            typedef typename default_area_result<ring_type>::type area_type;
+            std::vector<std::pair<area_type, std::size_t> > order;
+            order.reserve(outer_rings.size());
+            for (std::size_t j = 0; j < outer_rings.size(); j++)
+            {
+                order.push_back(std::make_pair(
+                    geometry::area(outer_rings[j]), j));
+            }
+            std::sort(order.begin(), order.end());
+
+            for (std::size_t i = 0; i < inner_rings.size(); i++)
+            {
+                ring_type const& inner = inner_rings[i];
+                for (std::size_t o = 0; o < order.size(); o++)
+                {
+                    std::size_t const j = order[o].second;
+                    // A hole can touch its outer ring, so take the first
+                    // vertex not located on it
+                    int code = 0;
+                    for (std::size_t k = 0; code == 0 && k < boost::size(inner); k++)
+                    {
+                        code = detail::within::point_in_geometry(
+                                    range::at(inner, k), outer_rings[j]);
+                    }
+                    if (code >= 0)
+                    {
+                        parents[i] = j;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (std::size_t j = 0; j < outer_rings.size(); j++)
+        {
+            PolygonOut polygon;
+            convert_clipped_ring<reverse, close>(outer_rings[j],
+                        geometry::exterior_ring(polygon));
+            for (std::size_t i = 0; i < inner_rings.size(); i++)
+            {
+                if (parents[i] == j)
+                {
+                    typename geometry::ring_type<PolygonOut>::type ring_out;
+                    convert_clipped_ring<reverse, close>(inner_rings[i], ring_out);
+                    range::push_back(geometry::interior_rings(polygon), ring_out);
+                }
+            }
+            *out++ = polygon;
+        }
+        return out;
+    }
+};
+
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
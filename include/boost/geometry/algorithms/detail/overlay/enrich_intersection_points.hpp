@@ -11,8 +11,6 @@
 
 #include <cstddef>
 #include <algorithm>
-#include <map>
-#include <set>
 #include <vector>
 
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
@@ -23,6 +21,7 @@
 #endif
 
 #include <boost/range.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <boost/geometry/iterators/ever_circling_iterator.hpp>
 #include <boost/geometry/algorithms/detail/ring_identifier.hpp>
@@ -30,6 +29,7 @@
 #include <boost/geometry/algorithms/detail/overlay/handle_colocations.hpp>
 #include <boost/geometry/algorithms/detail/overlay/less_by_segment_ratio.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
 #include <boost/geometry/algorithms/detail/overlay/sort_by_side.hpp>
 #include <boost/geometry/policies/robustness/robust_type.hpp>
 #include <boost/geometry/strategies/side.hpp>
@@ -170,83 +170,100 @@ inline void enrich_assign(Operations& operations, Turns& turns)
 }
 
 
-template <typename Turns, typename MappedVector>
+template <typename Turn>
+inline bool include_in_enrichment(Turn const& turn,
+        detail::overlay::operation_type for_operation)
+{
+    // Add all (non discarded) operations on this ring
+    // Blocked operations or uu on clusters (for intersection)
+    // should be included, to block potential paths in clusters
+    if (turn.discarded)
+    {
+        return false;
+    }
+
+    if (for_operation == operation_intersection
+        && turn.cluster_id == -1
+        && turn.both(operation_union))
+    {
+        // Only include uu turns if part of cluster (to block potential paths),
+        // otherwise they can block possibly viable paths
+        return false;
+    }
+    return true;
+}
+
+// Collects the indexed operations of all rings into one vector (the arena),
+// grouped per ring, in order of their turns (a counting sort on ring).
+// Afterwards ring_ends contains, per ring, the end of its operations in the
+// vector. The begin is the end of the previous ring (in ring order).
+template <typename Turns, typename Operations, typename RingEnds>
 inline void create_map(Turns const& turns,
         detail::overlay::operation_type for_operation,
-        MappedVector& mapped_vector)
+        Operations& operations,
+        RingEnds& ring_ends)
 {
     typedef typename boost::range_value<Turns>::type turn_type;
     typedef typename turn_type::container_type container_type;
-    typedef typename MappedVector::mapped_type mapped_type;
-    typedef typename boost::range_value<mapped_type>::type indexed_type;
+    typedef typename boost::range_value<Operations>::type indexed_type;
+    typedef typename boost::range_iterator<Turns const>::type turn_iterator;
+    typedef typename boost::range_iterator<container_type const>::type op_iterator;
 
-    std::size_t index = 0;
-    for (typename boost::range_iterator<Turns const>::type
-            it = boost::begin(turns);
-         it != boost::end(turns);
-         ++it, ++index)
+    operations.clear();
+    ring_ends.clear();
+
+    // Count operations per ring
+    std::size_t total = 0;
+    for (turn_iterator it = boost::begin(turns); it != boost::end(turns); ++it)
     {
-        // Add all (non discarded) operations on this ring
-        // Blocked operations or uu on clusters (for intersection)
-        // should be included, to block potential paths in clusters
-        turn_type const& turn = *it;
-        if (turn.discarded)
+        if (include_in_enrichment(*it, for_operation))
         {
-            continue;
+            for (op_iterator op_it = boost::begin(it->operations);
+                op_it != boost::end(it->operations); ++op_it)
+            {
+                ring_ends[ring_id_by_seg_id(op_it->seg_id)]++;
+                total++;
+            }
         }
+    }
+
+    // Convert counts to start positions
+    std::size_t position = 0;
+    for (typename RingEnds::iterator it = ring_ends.begin();
+         it != ring_ends.end(); ++it)
+    {
+        std::size_t const count = it->second;
+        it->second = position;
+        position += count;
+    }
 
-        if (for_operation == operation_intersection
-            && turn.cluster_id == -1
-            && turn.both(operation_union))
+    // Distribute the operations, start positions become end positions
+    operations.resize(total);
+    std::size_t index = 0;
+    for (turn_iterator it = boost::begin(turns);
+         it != boost::end(turns); ++it, ++index)
+    {
+        turn_type const& turn = *it;
+        if (! include_in_enrichment(turn, for_operation))
         {
-            // Only include uu turns if part of cluster (to block potential paths),
-            // otherwise they can block possibly viable paths
             continue;
         }
 
         std::size_t op_index = 0;
-        for (typename boost::range_iterator<container_type const>::type
-                op_it = boost::begin(turn.operations);
+        for (op_iterator op_it = boost::begin(turn.operations);
             op_it != boost::end(turn.operations);
             ++op_it, ++op_index)
         {
-            ring_identifier const ring_id
-                (
-                    op_it->seg_id.source_index,
-                    op_it->seg_id.multi_index,
-                    op_it->seg_id.ring_index
-                );
-            mapped_vector[ring_id].push_back
-                (
-                    indexed_type(index, op_index, *op_it,
-                        it->operations[1 - op_index].seg_id)
-                );
+            std::size_t& pos = ring_ends[ring_id_by_seg_id(op_it->seg_id)];
+            operations[pos++] = indexed_type(index, op_index, *op_it,
+                        turn.operations[1 - op_index].seg_id);
         }
     }
 }
 
 
-}} // namespace detail::overlay
-#endif //DOXYGEN_NO_DETAIL
-
-
-
-/*!
-\brief All intersection points are enriched with successor information
-\ingroup overlay
-\tparam Turns type of intersection container
-            (e.g. vector of "intersection/turn point"'s)
-\tparam Clusters type of cluster container
-\tparam Geometry1 \tparam_geometry
-\tparam Geometry2 \tparam_geometry
-\tparam Strategy side strategy type
-\param turns container containing intersection points
-\param clusters container containing clusters
-\param geometry1 \param_geometry
-\param geometry2 \param_geometry
-\param robust_policy policy to handle robustness issues
-\param strategy strategy
- */
+// Enriches turns, using the specified (possibly reused) containers for
+// the indexed operations and their ends per ring
 template
 <
     bool Reverse1, bool Reverse2,
@@ -255,31 +272,25 @@ template
     typename Clusters,
     typename Geometry1, typename Geometry2,
     typename RobustPolicy,
-    typename Strategy
+    typename Strategy,
+    typename Operations,
+    typename RingEnds
 >
 inline void enrich_intersection_points(Turns& turns,
     Clusters& clusters,
     Geometry1 const& geometry1, Geometry2 const& geometry2,
     RobustPolicy const& robust_policy,
-    Strategy const& strategy)
+    Strategy const& strategy,
+    Operations& operations,
+    RingEnds& ring_ends)
 {
-    static const detail::overlay::operation_type for_operation
-            = detail::overlay::operation_from_overlay<OverlayType>::value;
-    typedef typename boost::range_value<Turns>::type turn_type;
-    typedef typename turn_type::turn_operation_type op_type;
-    typedef detail::overlay::indexed_turn_operation
-        <
-            op_type
-        > indexed_turn_operation;
-
-    typedef std::map
-        <
-            ring_identifier,
-            std::vector<indexed_turn_operation>
-        > mapped_vector_type;
+    static const operation_type for_operation
+            = operation_from_overlay<OverlayType>::value;
+    typedef typename boost::range_iterator<Operations>::type operation_iterator;
+    typedef boost::iterator_range<operation_iterator> operation_range;
 
     bool const has_colocations
-        = detail::overlay::handle_colocations<Reverse1, Reverse2>(turns,
+        = handle_colocations<Reverse1, Reverse2>(turns,
         clusters, geometry1, geometry2);
 
     // Discard none turns, if any
@@ -288,59 +299,117 @@ inline void enrich_intersection_points(Turns& turns,
          it != boost::end(turns);
          ++it)
     {
-        if (it->both(detail::overlay::operation_none))
+        if (it->both(operation_none))
         {
             it->discarded = true;
         }
     }
 
-    // Create a map of vectors of indexed operation-types to be able
-    // to sort intersection points PER RING
-    mapped_vector_type mapped_vector;
-
-    detail::overlay::create_map(turns, for_operation, mapped_vector);
+    // Gather the indexed operation-types, per ring, into one vector, to be
+    // able to sort intersection points PER RING
+    create_map(turns, for_operation, operations, ring_ends);
 
-    // No const-iterator; contents of mapped copy is temporary,
+    // No const-iterator; contents of operations is temporary,
     // and changed by enrich
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
+    std::size_t begin = 0;
+    for (typename RingEnds::const_iterator mit = ring_ends.begin();
+        mit != ring_ends.end();
         ++mit)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-sort Ring "
         << mit->first << std::endl;
 #endif
-        detail::overlay::enrich_sort<Reverse1, Reverse2>(
-                    mit->second, turns, for_operation,
+        operation_range range(operations.begin() + begin,
+                              operations.begin() + mit->second);
+        enrich_sort<Reverse1, Reverse2>(
+                    range, turns, for_operation,
                     geometry1, geometry2,
                     robust_policy, strategy);
+        begin = mit->second;
     }
 
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
+    begin = 0;
+    for (typename RingEnds::const_iterator mit = ring_ends.begin();
+        mit != ring_ends.end();
         ++mit)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-assign Ring "
         << mit->first << std::endl;
 #endif
-        detail::overlay::enrich_assign(mit->second, turns);
+        operation_range range(operations.begin() + begin,
+                              operations.begin() + mit->second);
+        enrich_assign(range, turns);
+        begin = mit->second;
     }
 
     if (has_colocations)
     {
-        detail::overlay::gather_cluster_properties<Reverse1, Reverse2>(
+        gather_cluster_properties<Reverse1, Reverse2>(
                 clusters, turns, for_operation, geometry1, geometry2);
     }
 
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
-    //detail::overlay::check_graph(turns, for_operation);
+    //check_graph(turns, for_operation);
 #endif
 
 }
 
+
+}} // namespace detail::overlay
+#endif //DOXYGEN_NO_DETAIL
+
+
+
+/*!
+\brief All intersection points are enriched with successor information
+\ingroup overlay
+\tparam Turns type of intersection container
+            (e.g. vector of "intersection/turn point"'s)
+\tparam Clusters type of cluster container
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy side strategy type
+\param turns container containing intersection points
+\param clusters container containing clusters
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param robust_policy policy to handle robustness issues
+\param strategy strategy
+ */
+template
+<
+    bool Reverse1, bool Reverse2,
+    overlay_type OverlayType,
+    typename Turns,
+    typename Clusters,
+    typename Geometry1, typename Geometry2,
+    typename RobustPolicy,
+    typename Strategy
+>
+inline void enrich_intersection_points(Turns& turns,
+    Clusters& clusters,
+    Geometry1 const& geometry1, Geometry2 const& geometry2,
+    RobustPolicy const& robust_policy,
+    Strategy const& strategy)
+{
+    typedef typename boost::range_value<Turns>::type turn_type;
+    typedef detail::overlay::indexed_turn_operation
+        <
+            typename turn_type::turn_operation_type
+        > indexed_turn_operation;
+
+    std::vector<indexed_turn_operation> operations;
+    detail::overlay::ring_identifier_map<std::size_t> ring_ends;
+
+    detail::overlay::enrich_intersection_points
+        <
+            Reverse1, Reverse2, OverlayType
+        >(turns, clusters, geometry1, geometry2, robust_policy, strategy,
+          operations, ring_ends);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ENRICH_HPP
@@ -35,6 +35,8 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/policies/robustness/rescale_policy.hpp>
+
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
 #include <boost/geometry/views/reversible_view.hpp>
@@ -49,13 +51,13 @@
 #include <boost/geometry/strategies/intersection_strategies.hpp>
 #include <boost/geometry/strategies/intersection_result.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
 #include <boost/geometry/algorithms/detail/disjoint/point_point.hpp>
 
 #include <boost/geometry/algorithms/detail/interior_iterator.hpp>
-#include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
-#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_boxes.hpp>
 
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info_ll.hpp>
@@ -263,9 +265,14 @@ public :
                     // Also skip if index1 < index2 to avoid getting all
                     // intersections twice (only do this on same source!)
 
+                    // The sections can be passed in any order, so a
+                    // neighbouring segment can precede or follow
+
                     skip = (skip_larger && index1 >= index2)
                         || ndi2 == ndi1 + 1
+                        || ndi1 == ndi2 + 1
                         || neighbouring<Geometry1>(sec1, index1, index2)
+                        || neighbouring<Geometry1>(sec1, index2, index1)
                         ;
                 }
 
@@ -431,6 +438,71 @@ struct section_visitor
 
 };
 
+// Gets the filter for the segments of a geometry, sectionalized to get
+// turns with another geometry. By default all segments are accepted.
+template
+<
+    typename Geometry,
+    typename RobustPolicy,
+    typename CSTag = typename cs_tag<Geometry>::type
+>
+struct get_segment_filter
+{
+    typedef detail::sectionalize::no_segment_filter type;
+
+    template <typename OtherGeometry>
+    static inline type apply(OtherGeometry const& , RobustPolicy const& )
+    {
+        return type();
+    }
+};
+
+// With rescaling to integer coordinates, only segments intersecting the
+// envelope of the other geometry are sectionalized. Therefore the robust
+// points are not calculated for all points of a large geometry, if the
+// other geometry is small. The envelope is enlarged by two integer units,
+// such that all filtered segments are, also after rounding, disjoint
+// with all sections of the other geometry.
+template
+<
+    typename Geometry,
+    typename FpPoint, typename IntPoint, typename CalculationType
+>
+struct get_segment_filter
+    <
+        Geometry,
+        detail::robust_policy<FpPoint, IntPoint, CalculationType>,
+        cartesian_tag
+    >
+{
+    typedef model::box<typename point_type<Geometry>::type> box_type;
+    typedef detail::sectionalize::box_segment_filter<box_type> type;
+
+    template <typename OtherGeometry>
+    static inline type apply(OtherGeometry const& other,
+            detail::robust_policy<FpPoint, IntPoint, CalculationType> const& robust_policy)
+    {
+        typedef typename coordinate_type<box_type>::type coordinate_type;
+
+        // For an empty geometry the box is inverse, and all segments
+        // are filtered
+        box_type box = geometry::return_envelope<box_type>(other);
+
+        CalculationType const margin = 2.0 / robust_policy.m_multiplier;
+        enlarge<0>(box, boost::numeric_cast<coordinate_type>(margin));
+        enlarge<1>(box, boost::numeric_cast<coordinate_type>(margin));
+        return type(box);
+    }
+
+private :
+    template <std::size_t Dimension, typename Box, typename T>
+    static inline void enlarge(Box& box, T const& margin)
+    {
+        set<min_corner, Dimension>(box, get<min_corner, Dimension>(box) - margin);
+        set<max_corner, Dimension>(box, get<max_corner, Dimension>(box) + margin);
+    }
+};
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -464,13 +536,46 @@ public:
 
         sections_type sec1, sec2;
         typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+        std::size_t const max_count
+            = detail::sectionalize::default_max_count<point_type>();
+
+        // Segments of one geometry which cannot intersect the other geometry
+        // are not sectionalized. For the same source (self turns), the
+        // envelope of the other geometry contains all its segments.
+        detail::sectionalize::sectionalize_filtered<Reverse1, dimensions>(
+                geometry1, robust_policy,
+                get_segment_filter<Geometry1, RobustPolicy>::apply(geometry2, robust_policy),
+                sec1, 0, max_count);
+        detail::sectionalize::sectionalize_filtered<Reverse2, dimensions>(
+                geometry2, robust_policy,
+                get_segment_filter<Geometry2, RobustPolicy>::apply(geometry1, robust_policy),
+                sec2, 1, max_count);
+
+        apply_sections(source_id1, geometry1, sec1,
+                       source_id2, geometry2, sec2,
+                       robust_policy, turns, interrupt_policy);
+    }
 
-        geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
-                sec1, 0);
-        geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
-                sec2, 1);
-
-        // ... and then partition them, intersecting overlapping sections in visitor method
+    // Gets the turns from sections which are created before, such that
+    // sections of a geometry can be reused for several calls.
+    // The sections should be created with dimensions 0 and 1, the same
+    // Reverse and the same robust policy (not filtered, or filtered for
+    // the other geometry).
+    template
+    <
+        typename Sections,
+        typename RobustPolicy,
+        typename Turns,
+        typename InterruptPolicy
+    >
+    static inline void apply_sections(
+            int source_id1, Geometry1 const& geometry1, Sections const& sec1,
+            int source_id2, Geometry2 const& geometry2, Sections const& sec2,
+            RobustPolicy const& robust_policy,
+            Turns& turns,
+            InterruptPolicy& interrupt_policy)
+    {
+        // Visit overlapping sections, intersecting them in visitor method
         section_visitor
             <
                 Geometry1, Geometry2,
@@ -478,11 +583,11 @@ public:
                 Turns, TurnPolicy, RobustPolicy, InterruptPolicy
             > visitor(source_id1, geometry1, source_id2, geometry2, robust_policy, turns, interrupt_policy);
 
-        geometry::partition
+        // The visiting is interrupted as soon as the visitor returns false,
+        // i.e. when the interrupt policy tells that the result is known
+        detail::section::visit_sections
             <
-                box_type,
-                detail::section::get_section_box,
-                detail::section::overlaps_section_box
+                typename cs_tag<typename Sections::box_type>::type
             >::apply(sec1, sec2, visitor);
     }
 };
@@ -518,8 +623,9 @@ struct get_turns_cs
         >::type iterator_type;
 
 
+    // Returns false if interrupted
     template <typename RobustPolicy, typename Turns, typename InterruptPolicy>
-    static inline void apply(
+    static inline bool apply(
                 int source_id1, Range const& range,
                 int source_id2, Box const& box,
                 RobustPolicy const& robust_policy,
@@ -530,7 +636,7 @@ struct get_turns_cs
     {
         if ( boost::size(range) <= 1)
         {
-            return;
+            return true;
         }
 
         boost::array<box_point_type,4> bp;
@@ -587,18 +693,21 @@ struct get_turns_cs
                 )*/
             if (true)
             {
-                get_turns_with_box(seg_id, source_id2,
+                if (! get_turns_with_box(seg_id, source_id2,
                         *prev, *it, *next,
                         bp[0], bp[1], bp[2], bp[3],
                         // NOTE: some dummy values could be passed below since this would be called only for Polygons and Boxes
                         index == 0,
                         size_type(index) == segments_count1,
                         robust_policy,
-                        turns, interrupt_policy);
-                // Future performance enhancement:
-                // return if told by the interrupt policy
+                        turns, interrupt_policy))
+                {
+                    // Told by the interrupt policy
+                    return false;
+                }
             }
         }
+        return true;
     }
 
 private:
@@ -622,8 +731,9 @@ private:
         else return 0;
     }
 
+    // Returns false if interrupted
     template <typename RobustPolicy, typename Turns, typename InterruptPolicy>
-    static inline void get_turns_with_box(segment_identifier const& seg_id, int source_id2,
+    static inline bool get_turns_with_box(segment_identifier const& seg_id, int source_id2,
             // Points from a range:
             point_type const& rp0,
             point_type const& rp1,
@@ -646,6 +756,8 @@ private:
 
         typedef typename boost::range_value<Turns>::type turn_info;
 
+        std::size_t const size_before = boost::size(turns);
+
         turn_info ti;
         ti.operations[0].seg_id = seg_id;
 
@@ -675,9 +787,13 @@ private:
 
         if (InterruptPolicy::enabled)
         {
-            interrupt_policy.apply(turns);
+            // Pass only the turns of this segment
+            return ! interrupt_policy.apply(
+                        std::make_pair(range::pos(turns, size_before),
+                                       boost::end(turns)));
         }
 
+        return true;
     }
 
 };
@@ -692,7 +808,7 @@ template
 struct get_turns_polygon_cs
 {
     template <typename RobustPolicy, typename Turns, typename InterruptPolicy>
-    static inline void apply(
+    static inline bool apply(
             int source_id1, Polygon const& polygon,
             int source_id2, Box const& box,
             RobustPolicy const& robust_policy,
@@ -708,12 +824,15 @@ struct get_turns_polygon_cs
                 TurnPolicy
             > intersector_type;
 
-        intersector_type::apply(
+        if (! intersector_type::apply(
                 source_id1, geometry::exterior_ring(polygon),
                 source_id2, box,
                 robust_policy,
                 turns, interrupt_policy,
-                multi_index, -1);
+                multi_index, -1))
+        {
+            return false;
+        }
 
         signed_size_type i = 0;
 
@@ -722,14 +841,18 @@ struct get_turns_polygon_cs
         for (typename detail::interior_iterator<Polygon const>::type
                 it = boost::begin(rings); it != boost::end(rings); ++it, ++i)
         {
-            intersector_type::apply(
+            if (! intersector_type::apply(
                     source_id1, *it,
                     source_id2, box,
                     robust_policy,
                     turns, interrupt_policy,
-                    multi_index, i);
+                    multi_index, i))
+            {
+                return false;
+            }
         }
 
+        return true;
     }
 };
 
@@ -760,13 +883,16 @@ struct get_turns_multi_polygon_cs
              ++it, ++i)
         {
             // Call its single version
-            get_turns_polygon_cs
+            if (! get_turns_polygon_cs
                 <
                     typename boost::range_value<Multi>::type, Box,
                     Reverse, ReverseBox,
                     TurnPolicy
                 >::apply(source_id1, *it, source_id2, box,
-                            robust_policy, turns, interrupt_policy, i);
+                            robust_policy, turns, interrupt_policy, i))
+            {
+                return;
+            }
         }
     }
 };
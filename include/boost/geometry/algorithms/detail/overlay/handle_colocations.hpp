@@ -16,6 +16,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/geometry/core/point_order.hpp>
 #include <boost/geometry/algorithms/detail/overlay/cluster_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
@@ -140,6 +141,46 @@ private:
     Turns const& m_turns;
 };
 
+// Sorts operations on segment identifier, and (for the same segment) on turn
+// index, such that operations are grouped per segment in their turn order
+template <typename Turns>
+struct less_by_segment_and_index
+{
+    inline less_by_segment_and_index(Turns const& turns)
+        : m_turns(turns)
+    {
+    }
+
+    inline bool operator()(turn_operation_index const& left,
+                           turn_operation_index const& right) const
+    {
+        segment_identifier const& left_seg_id = seg_id(left);
+        segment_identifier const& right_seg_id = seg_id(right);
+
+        if (! (left_seg_id == right_seg_id))
+        {
+            return left_seg_id < right_seg_id;
+        }
+        return left.turn_index != right.turn_index
+            ? left.turn_index < right.turn_index
+            : left.op_index < right.op_index;
+    }
+
+    inline bool is_other_segment(turn_operation_index const& left,
+                                 turn_operation_index const& right) const
+    {
+        return ! (seg_id(left) == seg_id(right));
+    }
+
+private:
+    inline segment_identifier const& seg_id(turn_operation_index const& toi) const
+    {
+        return m_turns[toi.turn_index].operations[toi.op_index].seg_id;
+    }
+
+    Turns const& m_turns;
+};
+
 template <typename Operation, typename ClusterPerSegment>
 inline signed_size_type get_cluster_id(Operation const& op, ClusterPerSegment const& cluster_per_segment)
 {
@@ -222,12 +263,13 @@ inline void handle_colocation_cluster(Turns& turns,
     typedef typename boost::range_value<Turns>::type turn_type;
     typedef typename turn_type::turn_operation_type turn_operation_type;
 
-    std::vector<turn_operation_index>::const_iterator vit = operations.begin();
+    typename boost::range_iterator<Operations const>::type vit
+            = boost::begin(operations);
 
     turn_operation_index ref_toi = *vit;
     signed_size_type ref_id = -1;
 
-    for (++vit; vit != operations.end(); ++vit)
+    for (++vit; vit != boost::end(operations); ++vit)
     {
         turn_type& ref_turn = turns[ref_toi.turn_index];
         turn_operation_type const& ref_op
@@ -357,13 +399,13 @@ inline void remove_clusters(Turns& turns, Clusters& clusters)
     }
 }
 
-template <typename Turn, typename IdSet>
-inline void discard_ie_turn(Turn& turn, IdSet& ids, signed_size_type id)
+template <typename Turn, typename IdVector>
+inline void discard_ie_turn(Turn& turn, IdVector& ids, signed_size_type id)
 {
     turn.discarded = true;
     turn.cluster_id = -1;
     // To remove it later from clusters
-    ids.insert(id);
+    ids.push_back(id);
 }
 
 template <bool Reverse>
@@ -419,7 +461,7 @@ inline void discard_interior_exterior_turns(Turns& turns, Clusters& clusters)
     typedef std::set<signed_size_type>::const_iterator set_iterator;
     typedef typename boost::range_value<Turns>::type turn_type;
 
-    std::set<signed_size_type> ids_to_remove;
+    std::vector<signed_size_type> ids_to_remove;
 
     for (typename Clusters::iterator cit = clusters.begin();
          cit != clusters.end(); ++cit)
@@ -479,7 +521,8 @@ inline void discard_interior_exterior_turns(Turns& turns, Clusters& clusters)
         }
 
         // Erase from the ids (which cannot be done above)
-        for (set_iterator sit = ids_to_remove.begin();
+        for (std::vector<signed_size_type>::const_iterator sit
+                = ids_to_remove.begin();
              sit != ids_to_remove.end(); ++sit)
         {
             ids.erase(*sit);
@@ -506,53 +549,62 @@ template
 inline bool handle_colocations(Turns& turns, Clusters& clusters,
         Geometry1 const& geometry1, Geometry2 const& geometry2)
 {
-    typedef std::map
-        <
-            segment_identifier,
-            std::vector<turn_operation_index>
-        > map_type;
-
-    // Create and fill map on segment-identifier Map is sorted on seg_id,
-    // meaning it is sorted on ring_identifier too. This means that exterior
-    // rings are handled first. If there is a colocation on the exterior ring,
-    // that information can be used for the interior ring too
-    map_type map;
-
-    int index = 0;
+    typedef std::vector<turn_operation_index> operation_vector;
+    typedef operation_vector::iterator operation_iterator;
+    typedef boost::iterator_range<operation_iterator> operation_range;
+
+    // Create and fill a vector with all operations, sorted on
+    // segment-identifier. It is therefore sorted on ring_identifier too.
+    // This means that exterior rings are handled first. If there is a
+    // colocation on the exterior ring, that information can be used for the
+    // interior ring too
+    operation_vector operations;
+    operations.reserve(2 * boost::size(turns));
+
+    signed_size_type index = 0;
     for (typename boost::range_iterator<Turns>::type
             it = boost::begin(turns);
          it != boost::end(turns);
          ++it, ++index)
     {
-        map[it->operations[0].seg_id].push_back(turn_operation_index(index, 0));
-        map[it->operations[1].seg_id].push_back(turn_operation_index(index, 1));
+        operations.push_back(turn_operation_index(index, 0));
+        operations.push_back(turn_operation_index(index, 1));
     }
 
+    std::sort(operations.begin(), operations.end(),
+              less_by_segment_and_index<Turns>(turns));
+
+    // Determine ranges of operations on the same segment
     // Check if there are multiple turns on one or more segments,
     // if not then nothing is to be done
-    bool colocations = 0;
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end();
-         ++it)
+    std::vector<operation_range> colocated;
+    less_by_segment_and_index<Turns> const less_by_segment(turns);
+    for (operation_iterator it = operations.begin(); it != operations.end(); )
     {
-        if (it->second.size() > 1u)
+        operation_iterator next = it + 1;
+        while (next != operations.end()
+               && ! less_by_segment.is_other_segment(*it, *next))
         {
-            colocations = true;
-            break;
+            ++next;
         }
+        if (next - it > 1)
+        {
+            colocated.push_back(operation_range(it, next));
+        }
+        it = next;
     }
 
-    if (! colocations)
+    if (colocated.empty())
     {
         return false;
     }
 
-    // Sort all vectors, per same segment
+    // Sort all ranges, per same segment
     less_by_fraction_and_type<Turns> less(turns);
-    for (typename map_type::iterator it = map.begin();
-         it != map.end(); ++it)
+    for (typename std::vector<operation_range>::iterator it = colocated.begin();
+         it != colocated.end(); ++it)
     {
-        std::sort(it->second.begin(), it->second.end(), less);
+        std::sort(boost::begin(*it), boost::end(*it), less);
     }
 
     typedef typename boost::range_value<Turns>::type turn_type;
@@ -567,14 +619,11 @@ inline bool handle_colocations(Turns& turns, Clusters& clusters,
     cluster_per_segment_type cluster_per_segment;
     signed_size_type cluster_id = 0;
 
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end(); ++it)
+    for (typename std::vector<operation_range>::const_iterator it
+            = colocated.begin(); it != colocated.end(); ++it)
     {
-        if (it->second.size() > 1u)
-        {
-            handle_colocation_cluster(turns, cluster_id, cluster_per_segment,
-                it->second, geometry1, geometry2);
-        }
+        handle_colocation_cluster(turns, cluster_id, cluster_per_segment,
+            *it, geometry1, geometry2);
     }
 
     assign_cluster_to_turns(turns, clusters, cluster_per_segment);
@@ -586,13 +635,15 @@ inline bool handle_colocations(Turns& turns, Clusters& clusters,
     remove_clusters(turns, clusters);
 
 #if defined(BOOST_GEOMETRY_DEBUG_HANDLE_COLOCATIONS)
-    std::cout << "*** Colocations " << map.size() << std::endl;
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end(); ++it)
+    std::cout << "*** Colocations " << colocated.size() << std::endl;
+    for (typename std::vector<operation_range>::const_iterator it
+            = colocated.begin(); it != colocated.end(); ++it)
     {
-        std::cout << it->first << std::endl;
-        for (std::vector<turn_operation_index>::const_iterator vit
-             = it->second.begin(); vit != it->second.end(); ++vit)
+        std::cout << turns[boost::begin(*it)->turn_index]
+                    .operations[boost::begin(*it)->op_index].seg_id
+                  << std::endl;
+        for (operation_iterator vit = boost::begin(*it);
+             vit != boost::end(*it); ++vit)
         {
             turn_operation_index const& toi = *vit;
             std::cout << geometry::wkt(turns[toi.turn_index].point)
@@ -20,8 +20,11 @@
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/range/metafunctions.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
 #include <boost/geometry/core/is_areal.hpp>
 #include <boost/geometry/core/point_order.hpp>
 #include <boost/geometry/core/reverse_dispatch.hpp>
@@ -29,6 +32,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_intersection_points.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
@@ -430,6 +434,8 @@ struct intersection_insert
 
 
 // Any areal type with box:
+// Intersections of 2D cartesian areal geometries with a box, resulting in
+// polygons, are calculated by clipping, other cases by the overlay
 template
 <
     typename Geometry, typename Box,
@@ -446,8 +452,23 @@ struct intersection_insert
         Reverse1, Reverse2, ReverseOut,
         TagIn, box_tag, TagOut,
         true, true, true
-    > : detail::overlay::overlay
-        <Geometry, Box, Reverse1, Reverse2, ReverseOut, GeometryOut, OverlayType>
+    > : boost::mpl::if_c
+        <
+            OverlayType == overlay_intersection
+            && detail::intersection::is_areal_box_clip
+                <
+                    Geometry, Box, GeometryOut
+                >::value,
+            detail::intersection::intersection_areal_box
+                <
+                    Geometry, Box, GeometryOut
+                >,
+            detail::overlay::overlay
+                <
+                    Geometry, Box, Reverse1, Reverse2, ReverseOut,
+                    GeometryOut, OverlayType
+                >
+        >::type
 {};
 
 
@@ -42,6 +42,14 @@ struct indexed_turn_operation
     segment_identifier const* other_seg_id; // segment id of other segment of intersection of two segments
     TurnOperation const* subject;
 
+    inline indexed_turn_operation()
+        : turn_index(0)
+        , operation_index(0)
+        , skip(false)
+        , other_seg_id(NULL)
+        , subject(NULL)
+    {}
+
     inline indexed_turn_operation(std::size_t ti, std::size_t oi,
                 TurnOperation const& sub,
                 segment_identifier const& oid)
@@ -21,6 +21,11 @@
 
 #include <boost/range.hpp>
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/is_areal.hpp>
+#include <boost/geometry/core/point_order.hpp>
 
 
 #include <boost/geometry/algorithms/detail/overlay/cluster_info.hpp>
@@ -28,6 +33,7 @@
 #include <boost/geometry/algorithms/detail/overlay/enrichment_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_workspace.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
@@ -39,12 +45,16 @@
 
 #include <boost/geometry/algorithms/detail/overlay/add_rings.hpp>
 #include <boost/geometry/algorithms/detail/overlay/assign_parents.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
 #include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
 #include <boost/geometry/algorithms/detail/overlay/select_rings.hpp>
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
 #include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
 
+#include <boost/geometry/strategies/intersection_strategies.hpp>
+
 
 #ifdef BOOST_GEOMETRY_DEBUG_ASSEMBLE
 #  include <boost/geometry/io/dsv/write.hpp>
@@ -111,13 +121,7 @@ inline void get_ring_turn_info(TurnInfoMap& turn_info_map, Turns const& turns)
             op_it != boost::end(turn_info.operations);
             ++op_it)
         {
-            ring_identifier const ring_id
-                (
-                    op_it->seg_id.source_index,
-                    op_it->seg_id.multi_index,
-                    op_it->seg_id.ring_index
-                );
-            turn_info_map[ring_id].has_normal_turn = true;
+            turn_info_map[ring_id_by_seg_id(op_it->seg_id)].has_normal_turn = true;
         }
     }
 }
@@ -160,8 +164,8 @@ inline OutputIterator return_if_one_input_is_empty(Geometry1 const& geometry1,
 #endif
 
 
-    std::map<ring_identifier, ring_turn_info> empty;
-    std::map<ring_identifier, properties> all_of_one_of_them;
+    ring_identifier_map<ring_turn_info> empty;
+    ring_identifier_map<properties> all_of_one_of_them;
 
     select_rings<OverlayType>(geometry1, geometry2, empty, all_of_one_of_them);
     ring_container_type rings;
@@ -179,12 +183,17 @@ template
 >
 struct overlay
 {
-    template <typename RobustPolicy, typename OutputIterator, typename Strategy, typename Visitor>
+    template
+    <
+        typename RobustPolicy, typename OutputIterator, typename Strategy,
+        typename Workspace, typename Visitor
+    >
     static inline OutputIterator apply(
                 Geometry1 const& geometry1, Geometry2 const& geometry2,
                 RobustPolicy const& robust_policy,
                 OutputIterator out,
                 Strategy const& ,
+                Workspace& workspace,
                 Visitor& visitor)
     {
         bool const is_empty1 = geometry::is_empty(geometry1);
@@ -204,26 +213,34 @@ struct overlay
         }
 
         typedef typename geometry::point_type<GeometryOut>::type point_type;
-        typedef detail::overlay::traversal_turn_info
-        <
-            point_type,
-            typename geometry::segment_ratio_type<point_type, RobustPolicy>::type
-        > turn_info;
-        typedef std::deque<turn_info> turn_container_type;
-
-        typedef std::deque
-            <
-                typename geometry::ring_type<GeometryOut>::type
-            > ring_container_type;
-
-        // Define the clusters, mapping cluster_id -> turns
-        typedef std::map
+        typedef typename geometry::segment_ratio_type
             <
-                signed_size_type,
-                cluster_info
-            > cluster_type;
-
-        turn_container_type turns;
+                point_type, RobustPolicy
+            >::type segment_ratio_type;
+
+        BOOST_MPL_ASSERT_MSG
+            (
+                (boost::is_same
+                    <
+                        typename Workspace::point_type, point_type
+                    >::value
+                && boost::is_same
+                    <
+                        typename Workspace::segment_ratio_type,
+                        segment_ratio_type
+                    >::value),
+                WORKSPACE_DOES_NOT_MATCH_OUTPUT_OR_ROBUST_POLICY,
+                (types<typename Workspace::point_type, point_type>)
+            );
+
+        typedef typename Workspace::ring_container_type ring_container_type;
+        typedef typename Workspace::ring_properties_type properties;
+
+        // All intermediate containers are taken from the workspace,
+        // such that their capacity can be reused by subsequent calls
+        workspace.clear();
+
+        typename Workspace::turn_container_type& turns = workspace.turns;
 
 #ifdef BOOST_GEOMETRY_DEBUG_ASSEMBLE
 std::cout << "get turns" << std::endl;
@@ -241,12 +258,14 @@ std::cout << "get turns" << std::endl;
 std::cout << "enrich" << std::endl;
 #endif
         typename Strategy::side_strategy_type side_strategy;
-        cluster_type clusters;
+        typename Workspace::cluster_type& clusters = workspace.clusters;
 
-        geometry::enrich_intersection_points<Reverse1, Reverse2, OverlayType>(turns,
-                clusters, geometry1, geometry2,
-                    robust_policy,
-                    side_strategy);
+        detail::overlay::enrich_intersection_points
+            <
+                Reverse1, Reverse2, OverlayType
+            >(turns, clusters, geometry1, geometry2,
+              robust_policy, side_strategy,
+              workspace.indexed_operations, workspace.ring_ends);
 
         visitor.visit_turns(2, turns);
 
@@ -258,7 +277,7 @@ std::cout << "traverse" << std::endl;
         // Traverse through intersection/turn points and create rings of them.
         // Note that these rings are always in clockwise order, even in CCW polygons,
         // and are marked as "to be reversed" below
-        ring_container_type rings;
+        ring_container_type& rings = workspace.rings;
         traverse<Reverse1, Reverse2, Geometry1, Geometry2, OverlayType>::apply
                 (
                     geometry1, geometry2,
@@ -268,17 +287,14 @@ std::cout << "traverse" << std::endl;
                     visitor
                 );
 
-        std::map<ring_identifier, ring_turn_info> turn_info_per_ring;
-        get_ring_turn_info(turn_info_per_ring, turns);
-
-        typedef ring_properties
-        <
-            typename geometry::point_type<GeometryOut>::type
-        > properties;
+        get_ring_turn_info(workspace.turn_info_per_ring, turns);
 
         // Select all rings which are NOT touched by any intersection point
-        std::map<ring_identifier, properties> selected_ring_properties;
-        select_rings<OverlayType>(geometry1, geometry2, turn_info_per_ring,
+        typename Workspace::ring_properties_map_type& selected_ring_properties
+                = workspace.selected_ring_properties;
+        select_rings<OverlayType>(geometry1, geometry2,
+                workspace.turn_info_per_ring,
+                workspace.all_ring_properties,
                 selected_ring_properties);
 
         // Add rings created during traversal
@@ -300,6 +316,19 @@ std::cout << "traverse" << std::endl;
         return add_rings<GeometryOut>(selected_ring_properties, geometry1, geometry2, rings, out);
     }
 
+    template <typename RobustPolicy, typename OutputIterator, typename Strategy, typename Visitor>
+    static inline OutputIterator apply(
+                Geometry1 const& geometry1, Geometry2 const& geometry2,
+                RobustPolicy const& robust_policy,
+                OutputIterator out,
+                Strategy const& strategy,
+                Visitor& visitor)
+    {
+        overlay_workspace<GeometryOut, RobustPolicy> workspace;
+        return apply(geometry1, geometry2, robust_policy, out, strategy,
+                     workspace, visitor);
+    }
+
     template <typename RobustPolicy, typename OutputIterator, typename Strategy>
     static inline OutputIterator apply(
                 Geometry1 const& geometry1, Geometry2 const& geometry2,
@@ -313,6 +342,60 @@ std::cout << "traverse" << std::endl;
 };
 
 
+// Overlay of two areal geometries, using the intermediate containers
+// of the specified workspace (see overlay_workspace)
+template
+<
+    typename GeometryOut, overlay_type OverlayType,
+    typename Geometry1, typename Geometry2,
+    typename OutputIterator, typename Workspace
+>
+inline OutputIterator overlay_insert(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            OutputIterator out,
+            Workspace& workspace)
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            (geometry::is_areal<Geometry1>::value
+            && geometry::is_areal<Geometry2>::value
+            && geometry::is_areal<GeometryOut>::value),
+            OVERLAY_WORKSPACE_IS_ONLY_SUPPORTED_FOR_AREAL_GEOMETRIES,
+            (types<Geometry1, Geometry2, GeometryOut>)
+        );
+
+    typedef typename Workspace::robust_policy_type rescale_policy_type;
+
+    typedef intersection_strategies
+        <
+            typename cs_tag<GeometryOut>::type,
+            Geometry1,
+            Geometry2,
+            typename geometry::point_type<GeometryOut>::type,
+            rescale_policy_type
+        > strategy;
+
+    rescale_policy_type robust_policy
+            = geometry::get_rescale_policy<rescale_policy_type>(geometry1, geometry2);
+
+    overlay_null_visitor visitor;
+    return overlay
+        <
+            Geometry1, Geometry2,
+            do_reverse<geometry::point_order<Geometry1>::value>::value,
+            do_reverse
+                <
+                    geometry::point_order<Geometry2>::value,
+                    OverlayType == overlay_difference
+                >::value,
+            do_reverse<geometry::point_order<GeometryOut>::value>::value,
+            GeometryOut,
+            OverlayType
+        >::apply(geometry1, geometry2, robust_policy, out, strategy(),
+                 workspace, visitor);
+}
+
+
 }} // namespace detail::overlay
 #endif // DOXYGEN_NO_DETAIL
 
@@ -0,0 +1,133 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_WORKSPACE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_WORKSPACE_HPP
+
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+
+#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+#include <boost/geometry/algorithms/detail/overlay/cluster_info.hpp>
+#include <boost/geometry/algorithms/detail/overlay/less_by_segment_ratio.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
+#include <boost/geometry/algorithms/detail/overlay/select_rings.hpp>
+#include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
+
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Reusable workspace for overlay operations (intersection, union, difference)
+\ingroup overlay
+\details An overlay operation needs several intermediate containers (turns,
+    clusters, operations per ring, ring properties, traversed rings).
+    Normally they are created and destroyed in each call. If many small
+    overlay operations are done (for example clipping many polygons),
+    a workspace can be passed instead. All containers are cleared at the
+    start of each call but (where the container allows it) keep their
+    capacity, such that most heap traffic of subsequent calls is avoided.
+    A workspace can be used for one call at a time, it is not thread safe.
+\tparam Geometry Output geometry (or collection), defining the point type
+    and ring type of the intermediate results
+\tparam RobustPolicy Robustness policy, by default the rescale policy
+    used by the overlay for the point type of the output geometry
+*/
+template
+<
+    typename Geometry,
+    typename RobustPolicy = typename rescale_policy_type
+        <
+            typename geometry::point_type<Geometry>::type
+        >::type
+>
+class overlay_workspace
+{
+public :
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef typename geometry::ring_type<Geometry>::type ring_type;
+    typedef RobustPolicy robust_policy_type;
+    typedef typename geometry::segment_ratio_type
+        <
+            point_type, RobustPolicy
+        >::type segment_ratio_type;
+
+#ifndef DOXYGEN_NO_DETAIL
+    typedef detail::overlay::traversal_turn_info
+        <
+            point_type, segment_ratio_type
+        > turn_type;
+    typedef std::vector<turn_type> turn_container_type;
+    typedef std::map
+        <
+            signed_size_type,
+            detail::overlay::cluster_info
+        > cluster_type;
+    typedef std::deque<ring_type> ring_container_type;
+    typedef detail::overlay::ring_properties<point_type> ring_properties_type;
+    typedef detail::overlay::ring_identifier_map
+        <
+            detail::overlay::ring_turn_info
+        > turn_info_map_type;
+    typedef detail::overlay::ring_identifier_map
+        <
+            ring_properties_type
+        > ring_properties_map_type;
+    typedef std::vector
+        <
+            detail::overlay::indexed_turn_operation
+                <
+                    typename turn_type::turn_operation_type
+                >
+        > indexed_operation_vector;
+    typedef detail::overlay::ring_identifier_map<std::size_t> ring_end_map_type;
+#endif
+
+    //! Clears all intermediate results, keeping allocated capacity
+    inline void clear()
+    {
+        turns.clear();
+        clusters.clear();
+        rings.clear();
+        turn_info_per_ring.clear();
+        all_ring_properties.clear();
+        selected_ring_properties.clear();
+        indexed_operations.clear();
+        ring_ends.clear();
+    }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Containers used by the overlay, valid during one call
+    turn_container_type turns;
+    cluster_type clusters;
+    ring_container_type rings;
+    turn_info_map_type turn_info_per_ring;
+    ring_properties_map_type all_ring_properties;
+    ring_properties_map_type selected_ring_properties;
+    indexed_operation_vector indexed_operations;
+    ring_end_map_type ring_ends;
+#endif
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_WORKSPACE_HPP
@@ -152,12 +152,14 @@ private:
         item_visitor_type(OutputIterator& oit) : m_oit(oit) {}
 
         template <typename Item1, typename Item2>
-        inline void apply(Item1 const& item1, Item2 const& item2)
+        inline bool apply(Item1 const& item1, Item2 const& item2)
         {
             action_selector_pl_l
                 <
                     PointOut, overlay_intersection
                 >::apply(item1, Policy::apply(item1, item2), m_oit);
+
+            return true;
         }
 
     private:
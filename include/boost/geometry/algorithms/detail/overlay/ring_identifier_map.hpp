@@ -0,0 +1,246 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_RING_IDENTIFIER_MAP_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_RING_IDENTIFIER_MAP_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/algorithms/detail/ring_identifier.hpp>
+#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+#include <boost/geometry/algorithms/detail/overlay/segment_identifier.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+inline ring_identifier ring_id_by_seg_id(segment_identifier const& seg_id)
+{
+    return ring_identifier(seg_id.source_index, seg_id.multi_index, seg_id.ring_index);
+}
+
+
+/*!
+\brief Flat, index-addressed associative container keyed by ring_identifier
+\details Ring identifiers consist of small dense integers (source, multi,
+    ring). Instead of allocating one node per ring (as std::map does),
+    all values are stored contiguously in one vector and addressed through
+    a dense two-level index: one row per (source, multi_index), one cell
+    per ring_index. Rows live in one shared arena, which is grown
+    geometrically, so the number of allocations is logarithmic in the
+    number of rings.
+    The interface is the subset of std::map used by the overlay
+    (operator[], find, iteration in ring_identifier order, size, clear).
+    Iteration is in key order, as for std::map. If keys were not inserted
+    in ascending order, values are sorted (once) when iteration starts.
+    References to mapped values are invalidated by insertion of new keys.
+*/
+template <typename T>
+class ring_identifier_map
+{
+public :
+    typedef ring_identifier key_type;
+    typedef T mapped_type;
+    typedef std::pair<ring_identifier, T> value_type;
+    typedef std::vector<value_type> container_type;
+    typedef typename container_type::iterator iterator;
+    typedef typename container_type::const_iterator const_iterator;
+    typedef typename container_type::size_type size_type;
+
+    inline ring_identifier_map()
+        : m_sorted(true)
+    {}
+
+    inline void reserve(std::size_t count)
+    {
+        m_values.reserve(count);
+        m_cells.reserve(count + count / 2);
+    }
+
+    inline void clear()
+    {
+        // Keep the capacity of all vectors, such that the map can be reused
+        m_values.clear();
+        m_cells.clear();
+        for (typename std::vector<std::vector<row> >::iterator it
+                = m_rows.begin(); it != m_rows.end(); ++it)
+        {
+            it->clear();
+        }
+        m_sorted = true;
+    }
+
+    inline size_type size() const { return m_values.size(); }
+    inline bool empty() const { return m_values.empty(); }
+
+    inline iterator begin() { sort_if_necessary(); return m_values.begin(); }
+    inline iterator end() { return m_values.end(); }
+    inline const_iterator begin() const { sort_if_necessary(); return m_values.begin(); }
+    inline const_iterator end() const { return m_values.end(); }
+
+    inline iterator find(ring_identifier const& id)
+    {
+        signed_size_type const index = value_index(id);
+        return index < 0 ? m_values.end() : m_values.begin() + index;
+    }
+
+    inline const_iterator find(ring_identifier const& id) const
+    {
+        signed_size_type const index = value_index(id);
+        return index < 0 ? m_values.end() : m_values.begin() + index;
+    }
+
+    inline size_type count(ring_identifier const& id) const
+    {
+        return value_index(id) < 0 ? 0 : 1;
+    }
+
+    inline T& operator[](ring_identifier const& id)
+    {
+        signed_size_type& cell = get_cell(id);
+        if (cell < 0)
+        {
+            if (! m_values.empty() && ! (m_values.back().first < id))
+            {
+                m_sorted = false;
+            }
+            cell = static_cast<signed_size_type>(m_values.size());
+            m_values.push_back(value_type(id, T()));
+        }
+        return m_values[cell].second;
+    }
+
+private :
+
+    struct row
+    {
+        signed_size_type offset;
+        signed_size_type capacity;
+
+        inline row()
+            : offset(-1)
+            , capacity(0)
+        {}
+    };
+
+    struct less_by_key
+    {
+        inline bool operator()(value_type const& left, value_type const& right) const
+        {
+            return left.first < right.first;
+        }
+    };
+
+    inline signed_size_type value_index(ring_identifier const& id) const
+    {
+        signed_size_type const r = id.multi_index + 1;
+        signed_size_type const c = id.ring_index + 1;
+        if (id.source_index < 0
+            || id.source_index >= static_cast<signed_size_type>(m_rows.size())
+            || r < 0 || c < 0)
+        {
+            return -1;
+        }
+        std::vector<row> const& rows = m_rows[id.source_index];
+        if (r >= static_cast<signed_size_type>(rows.size())
+            || c >= rows[r].capacity)
+        {
+            return -1;
+        }
+        return m_cells[rows[r].offset + c];
+    }
+
+    inline signed_size_type& get_cell(ring_identifier const& id)
+    {
+        BOOST_GEOMETRY_ASSERT(id.source_index >= 0);
+        BOOST_GEOMETRY_ASSERT(id.multi_index >= -1);
+        BOOST_GEOMETRY_ASSERT(id.ring_index >= -1);
+
+        std::size_t const s = static_cast<std::size_t>(id.source_index);
+        std::size_t const r = static_cast<std::size_t>(id.multi_index + 1);
+        signed_size_type const c = id.ring_index + 1;
+
+        if (s >= m_rows.size())
+        {
+            m_rows.resize(s + 1);
+        }
+        std::vector<row>& rows = m_rows[s];
+        if (r >= rows.size())
+        {
+            rows.resize(r + 1);
+        }
+
+        row& rw = rows[r];
+        if (c >= rw.capacity)
+        {
+            // Move the row to the end of the arena, with at least double
+            // capacity. The old cells are abandoned (and reused after clear)
+            signed_size_type const capacity
+                = (std::max)(c + 1, rw.capacity * 2);
+            signed_size_type const offset
+                = static_cast<signed_size_type>(m_cells.size());
+            m_cells.resize(m_cells.size() + capacity, -1);
+            if (rw.capacity > 0)
+            {
+                std::copy(m_cells.begin() + rw.offset,
+                          m_cells.begin() + rw.offset + rw.capacity,
+                          m_cells.begin() + offset);
+            }
+            rw.offset = offset;
+            rw.capacity = capacity;
+        }
+        return m_cells[rw.offset + c];
+    }
+
+    inline void sort_if_necessary() const
+    {
+        if (m_sorted)
+        {
+            return;
+        }
+
+        std::sort(m_values.begin(), m_values.end(), less_by_key());
+
+        // Update the index, rows do not change
+        signed_size_type index = 0;
+        for (const_iterator it = m_values.begin(); it != m_values.end();
+             ++it, ++index)
+        {
+            ring_identifier const& id = it->first;
+            row const& rw = m_rows[id.source_index][id.multi_index + 1];
+            m_cells[rw.offset + id.ring_index + 1] = index;
+        }
+        m_sorted = true;
+    }
+
+    // Sorting is a logically const operation, done lazily on iteration
+    mutable container_type m_values;
+    mutable std::vector<signed_size_type> m_cells;
+    std::vector<std::vector<row> > m_rows;
+    mutable bool m_sorted;
+};
+
+
+}} // namespace detail::overlay
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_RING_IDENTIFIER_MAP_HPP
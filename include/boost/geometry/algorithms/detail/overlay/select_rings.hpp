@@ -283,6 +283,8 @@ inline void update_ring_selection(Geometry1 const& geometry1,
 
 /*!
 \brief The function select_rings select rings based on the overlay-type (union,intersection)
+\details The properties of all rings are gathered in all_ring_properties,
+    which is cleared first (and can be reused by the caller)
 */
 template
 <
@@ -294,12 +296,13 @@ template
 >
 inline void select_rings(Geometry1 const& geometry1, Geometry2 const& geometry2,
             RingTurnInfoMap const& turn_info_per_ring,
+            RingPropertyMap& all_ring_properties,
             RingPropertyMap& selected_ring_properties)
 {
     typedef typename geometry::tag<Geometry1>::type tag1;
     typedef typename geometry::tag<Geometry2>::type tag2;
 
-    RingPropertyMap all_ring_properties;
+    all_ring_properties.clear();
     dispatch::select_rings<tag1, Geometry1>::apply(geometry1, geometry2,
                 ring_identifier(0, -1, -1), all_ring_properties);
     dispatch::select_rings<tag2, Geometry2>::apply(geometry2, geometry1,
@@ -309,6 +312,23 @@ inline void select_rings(Geometry1 const& geometry1, Geometry2 const& geometry2,
                 all_ring_properties, selected_ring_properties);
 }
 
+template
+<
+    overlay_type OverlayType,
+    typename Geometry1,
+    typename Geometry2,
+    typename RingTurnInfoMap,
+    typename RingPropertyMap
+>
+inline void select_rings(Geometry1 const& geometry1, Geometry2 const& geometry2,
+            RingTurnInfoMap const& turn_info_per_ring,
+            RingPropertyMap& selected_ring_properties)
+{
+    RingPropertyMap all_ring_properties;
+    select_rings<OverlayType>(geometry1, geometry2, turn_info_per_ring,
+                all_ring_properties, selected_ring_properties);
+}
+
 template
 <
     overlay_type OverlayType,
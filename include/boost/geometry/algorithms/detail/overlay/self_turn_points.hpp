@@ -22,9 +22,8 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
-#include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
-#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_boxes.hpp>
 
 #include <boost/geometry/geometries/box.hpp>
 
@@ -54,8 +53,6 @@ struct no_interrupt_policy
 
 
 
-class self_ip_exception : public geometry::exception {};
-
 template
 <
     typename Geometry,
@@ -100,13 +97,8 @@ struct self_section_visitor
                             m_rescale_policy,
                             m_turns, m_interrupt_policy);
         }
-        if (BOOST_GEOMETRY_CONDITION(m_interrupt_policy.has_intersections))
-        {
-            // TODO: we should give partition an interrupt policy.
-            // Now we throw, and catch below, to stop the partition loop.
-            throw self_ip_exception();
-        }
-        return true;
+        // Interrupt partition if requested by the interrupt policy
+        return ! BOOST_GEOMETRY_CONDITION(m_interrupt_policy.has_intersections);
     }
 
 };
@@ -137,29 +129,45 @@ struct get_turns
         typedef boost::mpl::vector_c<std::size_t, 0> dimensions;
 
         sections_type sec;
-        geometry::sectionalize<false, dimensions>(geometry, robust_policy, sec);
+        geometry::sectionalize<false, dimensions>(geometry, robust_policy, sec,
+                0, detail::sectionalize::default_max_count
+                    <
+                        typename geometry::point_type<Geometry>::type
+                    >());
 
+        return apply_sections(geometry, sec, robust_policy, turns,
+                              interrupt_policy);
+    }
+
+    // Gets the turns from sections which are created before (not
+    // reversed, and with the same robust policy), such that sections of
+    // a geometry can be reused for several calls
+    template
+    <
+        typename Geometry,
+        typename Sections,
+        typename RobustPolicy,
+        typename Turns,
+        typename InterruptPolicy
+    >
+    static inline bool apply_sections(
+            Geometry const& geometry,
+            Sections const& sec,
+            RobustPolicy const& robust_policy,
+            Turns& turns,
+            InterruptPolicy& interrupt_policy)
+    {
         self_section_visitor
             <
                 Geometry,
                 Turns, TurnPolicy, RobustPolicy, InterruptPolicy
             > visitor(geometry, robust_policy, turns, interrupt_policy);
 
-        try
-        {
-            geometry::partition
-                <
-                    box_type,
-                    detail::section::get_section_box,
-                    detail::section::overlaps_section_box
-                >::apply(sec, visitor);
-        }
-        catch(self_ip_exception const& )
-        {
-            return false;
-        }
-
-        return true;
+        // false if interrupted
+        return detail::section::visit_sections
+            <
+                typename cs_tag<typename Sections::box_type>::type
+            >::apply(sec, visitor);
     }
 };
 
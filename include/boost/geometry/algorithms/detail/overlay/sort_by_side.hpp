@@ -14,6 +14,7 @@
 
 #include <boost/geometry/algorithms/detail/direction_code.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
+#include <boost/geometry/index/detail/varray.hpp>
 #include <boost/geometry/strategies/side.hpp>
 
 namespace boost { namespace geometry
@@ -38,6 +39,8 @@ struct ranked_point
         , count_right(0)
         , operation(operation_none)
         , only_turn_on_ring(false)
+        , side(0)
+        , collinear_code(0)
     {}
 
     template <typename Op>
@@ -54,6 +57,8 @@ struct ranked_point
         , operation(op.operation)
         , seg_id(op.seg_id)
         , only_turn_on_ring(op.enriched.only_turn_on_ring)
+        , side(0)
+        , collinear_code(0)
     {}
 
     Point point;
@@ -67,6 +72,11 @@ struct ranked_point
     operation_type operation;
     segment_identifier seg_id;
     bool only_turn_on_ring;
+
+    // Side with respect to the origin and the turn point, and if it is
+    // collinear, the direction code. Calculated once before sorting.
+    int side;
+    int collinear_code;
 };
 
 struct less_by_turn_index
@@ -105,6 +115,10 @@ struct less_false
     }
 };
 
+// Sorts ranked points by side with respect to p1 (the origin) and p2 (the
+// turn point). The sides (and direction codes) of the points with respect
+// to p1-p2 should be calculated before (see side_sorter::apply), such that
+// only the mutual sides of the points are calculated while sorting.
 template <typename Point, typename LessOnSame, typename Compare>
 struct less_by_side
 {
@@ -124,16 +138,16 @@ struct less_by_side
         LessOnSame on_same;
         Compare compare;
 
-        int const side_first = side::apply(m_p1, m_p2, first.point);
-        int const side_second = side::apply(m_p1, m_p2, second.point);
+        int const side_first = first.side;
+        int const side_second = second.side;
 
         if (side_first == 0 && side_second == 0)
         {
             // Both collinear. They might point into different directions: <------*------>
             // If so, order the one going backwards as the very first.
 
-            int const first_code = direction_code(m_p1, m_p2, first.point);
-            int const second_code = direction_code(m_p1, m_p2, second.point);
+            int const first_code = first.collinear_code;
+            int const second_code = second.collinear_code;
 
             // Order by code, backwards first, then forward.
             return first_code != second_code
@@ -142,14 +156,14 @@ struct less_by_side
                 ;
         }
         else if (side_first == 0
-                && direction_code(m_p1, m_p2, first.point) == -1)
+                && first.collinear_code == -1)
         {
             // First collinear and going backwards.
             // Order as the very first, so return always true
             return true;
         }
         else if (side_second == 0
-            && direction_code(m_p1, m_p2, second.point) == -1)
+            && second.collinear_code == -1)
         {
             // Second is collinear and going backwards
             // Order as very last, so return always false
@@ -185,6 +199,151 @@ private :
     Point m_p1, m_p2;
 };
 
+// Keeps the indices (of pieces) which are handled. Clusters have only a
+// few of them, which are kept in a fixed capacity buffer, so usually
+// without allocation
+class handled_indices
+{
+public :
+    // Returns true if the index was not yet handled
+    inline bool insert(signed_size_type index)
+    {
+        if (std::find(m_small.begin(), m_small.end(), index) != m_small.end())
+        {
+            return false;
+        }
+        if (m_small.size() < m_small.capacity())
+        {
+            m_small.push_back(index);
+            return true;
+        }
+
+        std::vector<signed_size_type>::iterator it
+            = std::lower_bound(m_large.begin(), m_large.end(), index);
+        if (it != m_large.end() && *it == index)
+        {
+            return false;
+        }
+        m_large.insert(it, index);
+        return true;
+    }
+
+private :
+    index::detail::varray<signed_size_type, 16> m_small;
+    std::vector<signed_size_type> m_large;
+};
+
+// Keeps the ranked points of a cluster. Most clusters have two or four
+// operations, each adding two points, which are kept in a fixed capacity
+// buffer, so usually without allocation. If there are more, all points are
+// moved to a vector.
+template <typename RankedPoint>
+class ranked_point_vector
+{
+    typedef index::detail::varray<RankedPoint, 8> small_type;
+
+public :
+    typedef RankedPoint value_type;
+    typedef RankedPoint* iterator;
+    typedef RankedPoint const* const_iterator;
+
+    inline void push_back(RankedPoint const& ranked_point)
+    {
+        if (m_large.empty() && m_small.size() < m_small.capacity())
+        {
+            m_small.push_back(ranked_point);
+            return;
+        }
+        if (m_large.empty())
+        {
+            m_large.reserve(2 * m_small.capacity());
+            m_large.assign(m_small.begin(), m_small.end());
+            m_small.clear();
+        }
+        m_large.push_back(ranked_point);
+    }
+
+    inline std::size_t size() const
+    {
+        return m_large.empty() ? m_small.size() : m_large.size();
+    }
+
+    inline bool empty() const
+    {
+        return size() == 0;
+    }
+
+    inline iterator begin()
+    {
+        return m_large.empty() ? m_small.begin() : &m_large.front();
+    }
+
+    inline iterator end()
+    {
+        return begin() + size();
+    }
+
+    inline const_iterator begin() const
+    {
+        return m_large.empty() ? m_small.begin() : &m_large.front();
+    }
+
+    inline const_iterator end() const
+    {
+        return begin() + size();
+    }
+
+    inline RankedPoint& operator[](std::size_t i)
+    {
+        return begin()[i];
+    }
+
+    inline RankedPoint const& operator[](std::size_t i) const
+    {
+        return begin()[i];
+    }
+
+    inline RankedPoint& back()
+    {
+        return end()[-1];
+    }
+
+    inline RankedPoint const& back() const
+    {
+        return end()[-1];
+    }
+
+private :
+    small_type m_small;
+    std::vector<RankedPoint> m_large;
+};
+
+// Keeps the sources (0 or 1) which are handled
+class handled_sources
+{
+public :
+    inline handled_sources()
+    {
+        m_handled[0] = false;
+        m_handled[1] = false;
+    }
+
+    // Returns true if the source was not yet handled
+    inline bool insert(signed_size_type source_index)
+    {
+        bool& handled = m_handled[source_index];
+        if (handled)
+        {
+            return false;
+        }
+        handled = true;
+        return true;
+    }
+
+private :
+    bool m_handled[2];
+};
+
 // Sorts vectors in counter clockwise order (by default)
 template <bool Reverse1, bool Reverse2, typename Point, typename Compare>
 struct side_sorter
@@ -248,6 +407,23 @@ public :
         // 3) to order by side, resulting in non-unique ranks
         //    to give colinear points
 
+        typedef typename strategy::side::services::default_strategy
+            <
+                typename cs_tag<Point>::type
+            >::type side_strategy;
+
+        // Calculate the sides w.r.t. origin and turn point once, instead
+        // of in each comparison
+        for (std::size_t i = 0; i < m_ranked_points.size(); i++)
+        {
+            rp& ranked = m_ranked_points[i];
+            ranked.side = side_strategy::apply(m_origin, turn_point,
+                                               ranked.point);
+            ranked.collinear_code = ranked.side == 0
+                ? direction_code(m_origin, turn_point, ranked.point)
+                : 0;
+        }
+
         // Sort by side and assign rank
         less_by_side<Point, less_by_index, Compare> less_unique(m_origin, turn_point);
         less_by_side<Point, less_false, Compare> less_non_unique(m_origin, turn_point);
@@ -268,8 +444,8 @@ public :
         }
     }
 
-    template <signed_size_type segment_identifier::*Member, typename Map>
-    void find_open_generic(Map& handled)
+    template <signed_size_type segment_identifier::*Member, typename Handled>
+    void find_open_generic(Handled& handled)
     {
         for (std::size_t i = 0; i < m_ranked_points.size(); i++)
         {
@@ -280,10 +456,9 @@ public :
             }
 
             signed_size_type const& index = ranked.seg_id.*Member;
-            if (! handled[index])
+            if (handled.insert(index))
             {
                 find_polygons_for_source<Member>(index, i);
-                handled[index] = true;
             }
         }
     }
@@ -306,7 +481,7 @@ public :
         if (one_source)
         {
             // by multi index
-            std::map<signed_size_type, bool> handled;
+            handled_indices handled;
             find_open_generic
                 <
                     &segment_identifier::piece_index
@@ -315,7 +490,7 @@ public :
         else
         {
             // by source (there should only source 0,1) TODO assert this
-            bool handled[2] = {false, false};
+            handled_sources handled;
             find_open_generic
                 <
                     &segment_identifier::source_index
@@ -363,7 +538,7 @@ public :
 
 //private :
 
-    typedef std::vector<rp> container_type;
+    typedef ranked_point_vector<rp> container_type;
     container_type m_ranked_points;
     Point m_origin;
 
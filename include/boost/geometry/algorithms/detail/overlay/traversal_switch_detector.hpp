@@ -16,6 +16,7 @@
 #include <boost/geometry/algorithms/detail/ring_identifier.hpp>
 #include <boost/geometry/algorithms/detail/overlay/copy_segments.hpp>
 #include <boost/geometry/algorithms/detail/overlay/cluster_info.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
@@ -27,12 +28,6 @@ namespace boost { namespace geometry
 namespace detail { namespace overlay
 {
 
-// Generic function (is this used somewhere else too?)
-inline ring_identifier ring_id_by_seg_id(segment_identifier const& seg_id)
-{
-    return ring_identifier(seg_id.source_index, seg_id.multi_index, seg_id.ring_index);
-}
-
 template
 <
     bool Reverse1,
@@ -82,14 +77,14 @@ struct traversal_switch_detector
 
     inline int get_region_id(turn_operation_type const& op) const
     {
-        std::map<ring_identifier, int>::const_iterator it
+        typename ring_identifier_map<int>::const_iterator it
                     = m_regions.find(ring_id_by_seg_id(op.seg_id));
         return it == m_regions.end() ? -1 : it->second;
     }
 
     void create_region(ring_identifier const& ring_id, std::set<signed_size_type> const& ring_turn_indices, int region_id = -1)
     {
-        std::map<ring_identifier, int>::const_iterator it = m_regions.find(ring_id);
+        typename ring_identifier_map<int>::const_iterator it = m_regions.find(ring_id);
         if (it != m_regions.end())
         {
             // The ring is already gathered in a region, quit
@@ -329,7 +324,7 @@ private:
     RobustPolicy const& m_robust_policy;
     Visitor& m_visitor;
 
-    std::map<ring_identifier, int> m_regions;
+    ring_identifier_map<int> m_regions;
     std::map<ring_identifier, std::set<signed_size_type> > m_turns_per_ring;
     int m_region_id;
 
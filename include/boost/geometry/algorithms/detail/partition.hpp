@@ -102,12 +102,13 @@ inline void expand_with_elements(Box& total, IteratorVector const& input)
 
 
 // Match forward_range with itself
+// Returns false if the visitor interrupted the process
 template <typename Policy, typename IteratorVector>
-inline void handle_one(IteratorVector const& input, Policy& policy)
+inline bool handle_one(IteratorVector const& input, Policy& policy)
 {
     if (boost::size(input) == 0)
     {
-        return;
+        return true;
     }
 
     typedef typename boost::range_iterator<IteratorVector const>::type it_type;
@@ -118,9 +119,13 @@ inline void handle_one(IteratorVector const& input, Policy& policy)
         it_type it2 = it1;
         for (++it2; it2 != boost::end(input); ++it2)
         {
-            policy.apply(**it1, **it2);
+            if (! policy.apply(**it1, **it2))
+            {
+                return false;
+            }
         }
     }
+    return true;
 }
 
 // Match forward range 1 with forward range 2
@@ -130,7 +135,7 @@ template
     typename IteratorVector1,
     typename IteratorVector2
 >
-inline void handle_two(IteratorVector1 const& input1,
+inline bool handle_two(IteratorVector1 const& input1,
         IteratorVector2 const& input2,
         Policy& policy)
 {
@@ -146,7 +151,7 @@ inline void handle_two(IteratorVector1 const& input1,
 
     if (boost::size(input1) == 0 || boost::size(input2) == 0)
     {
-        return;
+        return true;
     }
 
     for(iterator_type1 it1 = boost::begin(input1);
@@ -157,9 +162,13 @@ inline void handle_two(IteratorVector1 const& input1,
             it2 != boost::end(input2);
             ++it2)
         {
-            policy.apply(**it1, **it2);
+            if (! policy.apply(**it1, **it2))
+            {
+                return false;
+            }
         }
     }
+    return true;
 }
 
 template <typename IteratorVector>
@@ -227,14 +236,14 @@ class partition_one_range
     }
 
     template <typename Policy, typename IteratorVector>
-    static inline void next_level(Box const& box,
+    static inline bool next_level(Box const& box,
             IteratorVector const& input,
             std::size_t level, std::size_t min_elements,
             Policy& policy, VisitBoxPolicy& box_policy)
     {
         if (recurse_ok(input, min_elements, level))
         {
-            partition_one_range
+            return partition_one_range
             <
                 1 - Dimension,
                 Box,
@@ -245,14 +254,14 @@ class partition_one_range
         }
         else
         {
-            handle_one(input, policy);
+            return handle_one(input, policy);
         }
     }
 
     // Function to switch to two forward ranges if there are
     // geometries exceeding the separation line
     template <typename Policy, typename IteratorVector>
-    static inline void next_level2(Box const& box,
+    static inline bool next_level2(Box const& box,
             IteratorVector const& input1,
             IteratorVector const& input2,
             std::size_t level, std::size_t min_elements,
@@ -260,7 +269,7 @@ class partition_one_range
     {
         if (recurse_ok(input1, input2, min_elements, level))
         {
-            partition_two_ranges
+            return partition_two_ranges
             <
                 1 - Dimension,
                 Box,
@@ -272,13 +281,14 @@ class partition_one_range
         }
         else
         {
-            handle_two(input1, input2, policy);
+            return handle_two(input1, input2, policy);
         }
     }
 
 public :
+    // Returns false if the visitor interrupted the process
     template <typename Policy, typename IteratorVector>
-    static inline void apply(Box const& box,
+    static inline bool apply(Box const& box,
             IteratorVector const& input,
             std::size_t level,
             std::size_t min_elements,
@@ -300,20 +310,24 @@ public :
 
             // Recursively do exceeding elements only, in next dimension they
             // will probably be less exceeding within the new box
-            next_level(exceeding_box, exceeding, level, min_elements,
-                policy, box_policy);
-
-            // Switch to two forward ranges, combine exceeding with
-            // lower resp upper, but not lower/lower, upper/upper
-            next_level2(exceeding_box, exceeding, lower, level, min_elements,
-                policy, box_policy);
-            next_level2(exceeding_box, exceeding, upper, level, min_elements,
-                policy, box_policy);
+            if (! (next_level(exceeding_box, exceeding, level, min_elements,
+                              policy, box_policy)
+                // Switch to two forward ranges, combine exceeding with
+                // lower resp upper, but not lower/lower, upper/upper
+                && next_level2(exceeding_box, exceeding, lower, level, min_elements,
+                               policy, box_policy)
+                && next_level2(exceeding_box, exceeding, upper, level, min_elements,
+                               policy, box_policy)) )
+            {
+                return false;
+            }
         }
 
         // Recursively call operation both parts
-        next_level(lower_box, lower, level, min_elements, policy, box_policy);
-        next_level(upper_box, upper, level, min_elements, policy, box_policy);
+        return next_level(lower_box, lower, level, min_elements,
+                          policy, box_policy)
+            && next_level(upper_box, upper, level, min_elements,
+                          policy, box_policy);
     }
 };
 
@@ -335,13 +349,13 @@ class partition_two_ranges
         typename IteratorVector1,
         typename IteratorVector2
     >
-    static inline void next_level(Box const& box,
+    static inline bool next_level(Box const& box,
             IteratorVector1 const& input1,
             IteratorVector2 const& input2,
             std::size_t level, std::size_t min_elements,
             Policy& policy, VisitBoxPolicy& box_policy)
     {
-        partition_two_ranges
+        return partition_two_ranges
         <
             1 - Dimension,
             Box,
@@ -373,13 +387,14 @@ class partition_two_ranges
     }
 
 public :
+    // Returns false if the visitor interrupted the process
     template
     <
         typename Policy,
         typename IteratorVector1,
         typename IteratorVector2
     >
-    static inline void apply(Box const& box,
+    static inline bool apply(Box const& box,
             IteratorVector1 const& input1,
             IteratorVector2 const& input2,
             std::size_t level,
@@ -405,12 +420,18 @@ public :
             if (recurse_ok(exceeding1, exceeding2, min_elements, level))
             {
                 Box exceeding_box = get_new_box(exceeding1, exceeding2);
-                next_level(exceeding_box, exceeding1, exceeding2, level,
-                           min_elements, policy, box_policy);
+                if (! next_level(exceeding_box, exceeding1, exceeding2, level,
+                                 min_elements, policy, box_policy))
+                {
+                    return false;
+                }
             }
             else
             {
-                handle_two(exceeding1, exceeding2, policy);
+                if (! handle_two(exceeding1, exceeding2, policy))
+                {
+                    return false;
+                }
             }
 
             // All exceeding from 1 with lower and upper of 2:
@@ -420,15 +441,21 @@ public :
             if (recurse_ok(lower2, upper2, exceeding1, min_elements, level))
             {
                 Box exceeding_box = get_new_box<ExpandPolicy1>(exceeding1);
-                next_level(exceeding_box, exceeding1, lower2, level,
-                           min_elements, policy, box_policy);
-                next_level(exceeding_box, exceeding1, upper2, level,
-                           min_elements, policy, box_policy);
+                if (! next_level(exceeding_box, exceeding1, lower2, level,
+                                 min_elements, policy, box_policy)
+                    || ! next_level(exceeding_box, exceeding1, upper2, level,
+                                    min_elements, policy, box_policy))
+                {
+                    return false;
+                }
             }
             else
             {
-                handle_two(exceeding1, lower2, policy);
-                handle_two(exceeding1, upper2, policy);
+                if (! handle_two(exceeding1, lower2, policy)
+                    || ! handle_two(exceeding1, upper2, policy))
+                {
+                    return false;
+                }
             }
         }
 
@@ -438,35 +465,48 @@ public :
             if (recurse_ok(lower1, upper1, exceeding2, min_elements, level))
             {
                 Box exceeding_box = get_new_box<ExpandPolicy2>(exceeding2);
-                next_level(exceeding_box, lower1, exceeding2, level,
-                    min_elements, policy, box_policy);
-                next_level(exceeding_box, upper1, exceeding2, level,
-                    min_elements, policy, box_policy);
+                if (! next_level(exceeding_box, lower1, exceeding2, level,
+                                 min_elements, policy, box_policy)
+                    || ! next_level(exceeding_box, upper1, exceeding2, level,
+                                    min_elements, policy, box_policy))
+                {
+                    return false;
+                }
             }
             else
             {
-                handle_two(lower1, exceeding2, policy);
-                handle_two(upper1, exceeding2, policy);
+                if (! handle_two(lower1, exceeding2, policy)
+                    || ! handle_two(upper1, exceeding2, policy))
+                {
+                    return false;
+                }
             }
         }
 
         if (recurse_ok(lower1, lower2, min_elements, level))
         {
-            next_level(lower_box, lower1, lower2, level,
-                       min_elements, policy, box_policy);
+            if (! next_level(lower_box, lower1, lower2, level,
+                             min_elements, policy, box_policy))
+            {
+                return false;
+            }
         }
         else
         {
-            handle_two(lower1, lower2, policy);
+            if (! handle_two(lower1, lower2, policy))
+            {
+                return false;
+            }
         }
+
         if (recurse_ok(upper1, upper2, min_elements, level))
         {
-            next_level(upper_box, upper1, upper2, level,
-                       min_elements, policy, box_policy);
+            return next_level(upper_box, upper1, upper2, level,
+                              min_elements, policy, box_policy);
         }
         else
         {
-            handle_two(upper1, upper2, policy);
+            return handle_two(upper1, upper2, policy);
         }
     }
 };
@@ -527,8 +567,10 @@ class partition
     }
 
 public :
+    // Visits all pairs of items having overlapping boxes. The visitor returns
+    // false to interrupt the process, apply then returns false as well
     template <typename ForwardRange, typename VisitPolicy>
-    static inline void apply(ForwardRange const& forward_range,
+    static inline bool apply(ForwardRange const& forward_range,
             VisitPolicy& visitor,
             std::size_t min_elements = 16,
             VisitBoxPolicy box_visitor = detail::partition::visit_no_policy()
@@ -547,7 +589,7 @@ public :
             expand_to_range<ExpandPolicy1, IncludePolicy1>(forward_range,
                     total, iterator_vector);
 
-            detail::partition::partition_one_range
+            return detail::partition::partition_one_range
                 <
                     0, Box,
                     OverlapsPolicy1,
@@ -565,10 +607,14 @@ public :
                 iterator_type it2 = it1;
                 for(++it2; it2 != boost::end(forward_range); ++it2)
                 {
-                    visitor.apply(*it1, *it2);
+                    if (! visitor.apply(*it1, *it2))
+                    {
+                        return false;
+                    }
                 }
             }
         }
+        return true;
     }
 
     template
@@ -577,7 +623,7 @@ public :
         typename ForwardRange2,
         typename VisitPolicy
     >
-    static inline void apply(ForwardRange1 const& forward_range1,
+    static inline bool apply(ForwardRange1 const& forward_range1,
                 ForwardRange2 const& forward_range2,
                 VisitPolicy& visitor,
                 std::size_t min_elements = 16,
@@ -607,7 +653,7 @@ public :
             expand_to_range<ExpandPolicy2, IncludePolicy2>(forward_range2,
                     total, iterator_vector2);
 
-            detail::partition::partition_two_ranges
+            return detail::partition::partition_two_ranges
                 <
                     0, Box, OverlapsPolicy1, OverlapsPolicy2,
                     ExpandPolicy1, ExpandPolicy2, VisitBoxPolicy
@@ -624,10 +670,14 @@ public :
                     it2 != boost::end(forward_range2);
                     ++it2)
                 {
-                    visitor.apply(*it1, *it2);
+                    if (! visitor.apply(*it1, *it2))
+                    {
+                        return false;
+                    }
                 }
             }
         }
+        return true;
     }
 };
 
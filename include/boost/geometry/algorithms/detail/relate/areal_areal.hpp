@@ -19,6 +19,7 @@
 #include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/range.hpp>
 
+#include <boost/geometry/algorithms/num_geometries.hpp>
 #include <boost/geometry/algorithms/num_interior_rings.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/detail/sub_range.hpp>
@@ -318,8 +319,13 @@ struct areal_areal
             : m_result(result)
             , m_geometry1(geometry1)
             , m_geometry2(geometry2)
+            , m_single_rings(has_single_ring(geometry1)
+                          && has_single_ring(geometry2))
         {}
 
+        // Called by get_turns for the turns of each pair of segments,
+        // directly after they are generated. If it returns true, the result
+        // is known, and get_turns is interrupted.
         template <typename Range>
         inline bool apply(Range const& turns)
         {
@@ -327,14 +333,50 @@ struct areal_areal
             
             for (iterator it = boost::begin(turns) ; it != boost::end(turns) ; ++it)
             {
-                per_turn<0>(*it);
-                per_turn<1>(*it);
+                if (m_single_rings && it->method == overlay::method_crosses)
+                {
+                    per_crossing(*it);
+                }
+                else
+                {
+                    per_turn<0>(*it);
+                    per_turn<1>(*it);
+                }
+
+                if (m_result.interrupt)
+                {
+                    return true;
+                }
             }
 
             return m_result.interrupt;
         }
 
     private:
+        template <typename Areal>
+        static inline bool has_single_ring(Areal const& areal)
+        {
+            return geometry::num_geometries(areal) == 1
+                && geometry::num_interior_rings(areal) == 0;
+        }
+
+        // The boundaries cross each other at a point in the middle of
+        // two segments. If both geometries consist of one ring, the
+        // boundaries are not touching themselves at that point, and near
+        // it all four combinations of interior and exterior are present
+        template <typename Turn>
+        inline void per_crossing(Turn const& )
+        {
+            update<boundary, boundary, '0', false>(m_result);
+            update<interior, interior, '2', false>(m_result);
+            update<interior, exterior, '2', false>(m_result);
+            update<exterior, interior, '2', false>(m_result);
+            update<interior, boundary, '1', false>(m_result);
+            update<boundary, interior, '1', false>(m_result);
+            update<exterior, boundary, '1', false>(m_result);
+            update<boundary, exterior, '1', false>(m_result);
+        }
+
         template <std::size_t OpId, typename Turn>
         inline void per_turn(Turn const& turn)
         {
@@ -383,6 +425,7 @@ struct areal_areal
         Result & m_result;
         Geometry1 const& m_geometry1;
         Geometry2 const& m_geometry2;
+        bool const m_single_rings;
     };
 
     // This analyser should be used like Input or SinglePass Iterator
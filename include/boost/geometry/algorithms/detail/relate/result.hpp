@@ -547,6 +547,84 @@ inline bool check_matrix(Mask const& mask, Matrix const& matrix)
     return check_dispatch<Mask>::apply(mask, matrix);
 }
 
+// check_decided()
+
+// Returns true if the result is known before all turns are analysed.
+// This is the case if a mask containing only 'T' and '*' is matched,
+// because elements of the matrix are only updated to higher dimensions.
+// So a matched 'T' cannot be unmatched anymore.
+template <typename Mask>
+struct check_decided_dispatch
+{
+    template <typename Matrix>
+    static inline bool apply(Mask const& mask, Matrix const& matrix)
+    {
+        return is_decidable(mask)
+            && check_dispatch<Mask>::apply(mask, matrix);
+    }
+
+    static inline bool is_decidable(Mask const& mask)
+    {
+        return per_one<interior, interior>(mask)
+            && per_one<interior, boundary>(mask)
+            && per_one<interior, exterior>(mask)
+            && per_one<boundary, interior>(mask)
+            && per_one<boundary, boundary>(mask)
+            && per_one<boundary, exterior>(mask)
+            && per_one<exterior, interior>(mask)
+            && per_one<exterior, boundary>(mask)
+            && per_one<exterior, exterior>(mask);
+    }
+
+    template <field F1, field F2>
+    static inline bool per_one(Mask const& mask)
+    {
+        const char mask_el = mask.template get<F1, F2>();
+        return mask_el == 'T' || mask_el == '*';
+    }
+};
+
+template <typename Masks, int I = 0, int N = boost::tuples::length<Masks>::value>
+struct check_decided_dispatch_tuple
+{
+    template <typename Matrix>
+    static inline bool apply(Masks const& masks, Matrix const& matrix)
+    {
+        typedef typename boost::tuples::element<I, Masks>::type mask_type;
+        mask_type const& mask = boost::get<I>(masks);
+        return check_decided_dispatch<mask_type>::apply(mask, matrix)
+            || check_decided_dispatch_tuple<Masks, I+1>::apply(masks, matrix);
+    }
+};
+
+template <typename Masks, int N>
+struct check_decided_dispatch_tuple<Masks, N, N>
+{
+    template <typename Matrix>
+    static inline bool apply(Masks const&, Matrix const&)
+    {
+        return false;
+    }
+};
+
+template <typename Head, typename Tail>
+struct check_decided_dispatch< boost::tuples::cons<Head, Tail> >
+{
+    typedef boost::tuples::cons<Head, Tail> mask_type;
+
+    template <typename Matrix>
+    static inline bool apply(mask_type const& mask, Matrix const& matrix)
+    {
+        return check_decided_dispatch_tuple<mask_type>::apply(mask, matrix);
+    }
+};
+
+template <typename Mask, typename Matrix>
+inline bool check_decided(Mask const& mask, Matrix const& matrix)
+{
+    return check_decided_dispatch<Mask>::apply(mask, matrix);
+}
+
 // matrix_width
 
 template <typename MatrixOrMask>
@@ -603,12 +681,13 @@ public:
 
     inline explicit mask_handler(Mask const& m)
         : interrupt(false)
+        , m_decided(false)
         , m_mask(m)
     {}
 
     result_type result() const
     {
-        return !interrupt
+        return (!interrupt || m_decided)
             && check_matrix(m_mask, base_t::matrix());
     }
 
@@ -630,6 +709,7 @@ public:
         else
         {
             base_t::template set<F1, F2, V>();
+            check_decided();
         }
     }
 
@@ -643,10 +723,24 @@ public:
         else
         {
             base_t::template update<F1, F2, V>();
+            check_decided();
         }
     }
 
 private:
+    // Interrupt if the result is known to be true
+    inline void check_decided()
+    {
+        if ( BOOST_GEOMETRY_CONDITION(Interrupt)
+          && ! m_decided
+          && relate::check_decided(m_mask, base_t::matrix()) )
+        {
+            interrupt = true;
+            m_decided = true;
+        }
+    }
+
+    bool m_decided;
     Mask const& m_mask;
 };
 
@@ -1070,6 +1164,103 @@ struct static_check_matrix
     }
 };
 
+// static_check_decided
+
+// Compile-time version of check_decided(): returns true if a mask containing
+// only 'T' and '*' is matched
+
+template <typename StaticMask, bool IsSequence>
+struct static_check_decided_dispatch
+{
+    template <field F1, field F2>
+    struct per_one
+    {
+        static const char mask_el = StaticMask::template static_get<F1, F2>::value;
+        static const bool value = mask_el == 'T' || mask_el == '*';
+    };
+
+    static const bool enabled
+        = per_one<interior, interior>::value
+       && per_one<interior, boundary>::value
+       && per_one<interior, exterior>::value
+       && per_one<boundary, interior>::value
+       && per_one<boundary, boundary>::value
+       && per_one<boundary, exterior>::value
+       && per_one<exterior, interior>::value
+       && per_one<exterior, boundary>::value
+       && per_one<exterior, exterior>::value;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return BOOST_GEOMETRY_CONDITION(enabled)
+            && static_check_dispatch<StaticMask, false>::apply(matrix);
+    }
+};
+
+template <typename First, typename Last>
+struct static_check_decided_sequence
+{
+    typedef typename boost::mpl::deref<First>::type StaticMask;
+    typedef static_check_decided_dispatch
+        <
+            StaticMask,
+            boost::mpl::is_sequence<StaticMask>::value
+        > current;
+    typedef static_check_decided_sequence
+        <
+            typename boost::mpl::next<First>::type,
+            Last
+        > next;
+
+    static const bool enabled = current::enabled || next::enabled;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return current::apply(matrix) || next::apply(matrix);
+    }
+};
+
+template <typename Last>
+struct static_check_decided_sequence<Last, Last>
+{
+    static const bool enabled = false;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& /*matrix*/)
+    {
+        return false;
+    }
+};
+
+template <typename StaticMask>
+struct static_check_decided_dispatch<StaticMask, true>
+{
+    typedef static_check_decided_sequence
+        <
+            typename boost::mpl::begin<StaticMask>::type,
+            typename boost::mpl::end<StaticMask>::type
+        > sequence;
+
+    static const bool enabled = sequence::enabled;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return sequence::apply(matrix);
+    }
+};
+
+template <typename StaticMask>
+struct static_check_decided
+    : static_check_decided_dispatch
+        <
+            StaticMask,
+            boost::mpl::is_sequence<StaticMask>::value
+        >
+{};
+
 // static_mask_handler
 
 template <typename StaticMask, bool Interrupt>
@@ -1085,15 +1276,17 @@ public:
 
     inline static_mask_handler()
         : interrupt(false)
+        , m_decided(false)
     {}
 
     inline explicit static_mask_handler(StaticMask const& /*dummy*/)
         : interrupt(false)
+        , m_decided(false)
     {}
 
     result_type result() const
     {
-        return (!Interrupt || !interrupt)
+        return (!Interrupt || !interrupt || m_decided)
             && static_check_matrix<StaticMask>::apply(base_type::matrix());
     }
 
@@ -1146,6 +1339,7 @@ private:
     inline void set_dispatch(integral_constant<int, 1>)
     {
         base_type::template set<F1, F2, V>();
+        check_decided();
     }
     // else
     template <field F1, field F2, char V>
@@ -1163,11 +1357,26 @@ private:
     inline void update_dispatch(integral_constant<int, 1>)
     {
         base_type::template update<F1, F2, V>();
+        check_decided();
     }
     // else
     template <field F1, field F2, char V>
     inline void update_dispatch(integral_constant<int, 2>)
     {}
+
+    // Interrupt if the result is known to be true
+    inline void check_decided()
+    {
+        if ( BOOST_GEOMETRY_CONDITION(Interrupt && static_check_decided<StaticMask>::enabled)
+          && ! m_decided
+          && static_check_decided<StaticMask>::apply(base_type::matrix()) )
+        {
+            interrupt = true;
+            m_decided = true;
+        }
+    }
+
+    bool m_decided;
 };
 
 // --------------- UTIL FUNCTIONS ----------------
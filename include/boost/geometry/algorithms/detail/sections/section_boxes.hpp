@@ -0,0 +1,411 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_BOXES_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_BOXES_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// The bounding boxes of a collection of 2D cartesian sections, stored as
+// a structure of arrays. The boxes are sorted on their minimum in the
+// sweep dimension (unless specified otherwise), the index refers to the
+// section in the collection. The arrays are scanned consecutively,
+// without touching the sections.
+template <typename CoordinateType>
+struct section_boxes
+{
+    std::vector<CoordinateType> sweep_min, sweep_max;
+    std::vector<CoordinateType> other_min, other_max;
+    std::vector<std::size_t> index;
+
+    inline std::size_t size() const
+    {
+        return index.size();
+    }
+
+    template <typename Sections>
+    inline void assign(Sections const& sections, std::size_t sweep_dimension,
+                       bool sorted = true)
+    {
+        if (sweep_dimension == 0)
+        {
+            assign<0>(sections, sorted);
+        }
+        else
+        {
+            assign<1>(sections, sorted);
+        }
+    }
+
+    inline void clear()
+    {
+        sweep_min.clear();
+        sweep_max.clear();
+        other_min.clear();
+        other_max.clear();
+        index.clear();
+    }
+
+private :
+    template <std::size_t SweepDimension, typename Sections>
+    inline void assign(Sections const& sections, bool sorted)
+    {
+        std::size_t const other_dimension = 1 - SweepDimension;
+        std::size_t const count = boost::size(sections);
+
+        std::vector<std::pair<CoordinateType, std::size_t> > order;
+        order.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            order.push_back(std::make_pair(
+                get<min_corner, SweepDimension>(sections[i].bounding_box), i));
+        }
+        if (sorted)
+        {
+            std::sort(order.begin(), order.end());
+        }
+
+        clear();
+        reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            std::size_t const s = order[i].second;
+            typename boost::range_value<Sections>::type::box_type const& box
+                = sections[s].bounding_box;
+            sweep_min.push_back(get<min_corner, SweepDimension>(box));
+            sweep_max.push_back(get<max_corner, SweepDimension>(box));
+            other_min.push_back(get<min_corner, other_dimension>(box));
+            other_max.push_back(get<max_corner, other_dimension>(box));
+            index.push_back(s);
+        }
+    }
+
+    inline void reserve(std::size_t count)
+    {
+        sweep_min.reserve(count);
+        sweep_max.reserve(count);
+        other_min.reserve(count);
+        other_max.reserve(count);
+        index.reserve(count);
+    }
+};
+
+
+// Returns the most selective dimension to sweep over: the dimension in
+// which, on average, the fewest boxes cross a line perpendicular to it.
+// That is the sum of the extents of the boxes divided by the extent of all
+// boxes (for example the rows of a lawnmower track should be swept across,
+// and not along the rows).
+template <typename Sections>
+inline std::size_t sweep_dimension(Sections const& sections)
+{
+    typedef typename boost::range_value<Sections>::type::box_type box_type;
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<box_type>::type,
+            double
+        >::type calculation_type;
+
+    box_type total;
+    geometry::assign_inverse(total);
+    calculation_type sum0 = 0, sum1 = 0;
+    for (std::size_t i = 0; i < boost::size(sections); i++)
+    {
+        box_type const& box = sections[i].bounding_box;
+        geometry::expand(total, box);
+        sum0 += calculation_type(get<max_corner, 0>(box))
+              - calculation_type(get<min_corner, 0>(box));
+        sum1 += calculation_type(get<max_corner, 1>(box))
+              - calculation_type(get<min_corner, 1>(box));
+    }
+
+    calculation_type const extent0 = calculation_type(get<max_corner, 0>(total))
+                                   - calculation_type(get<min_corner, 0>(total));
+    calculation_type const extent1 = calculation_type(get<max_corner, 1>(total))
+                                   - calculation_type(get<min_corner, 1>(total));
+
+    // Compares sum1 / extent1 < sum0 / extent0 without dividing
+    return sum1 * extent0 < sum0 * extent1 ? 1 : 0;
+}
+
+// Visits, for box i, all boxes starting at start whose sweep minimum is
+// not beyond the sweep maximum of box i. The boxes from start should not
+// start before box i.
+template <typename Boxes, typename Visitor>
+inline bool sweep_one_box(Boxes const& boxes, std::size_t i,
+            std::size_t start, Visitor& visitor)
+{
+    std::size_t const count = boxes.size();
+    for (std::size_t j = start;
+         j < count && ! (boxes.sweep_min[j] > boxes.sweep_max[i]);
+         j++)
+    {
+        // Box j does not start before box i, so only the other dimension
+        // needs to be checked
+        if (boxes.other_max[j] < boxes.other_min[i]
+            || boxes.other_min[j] > boxes.other_max[i])
+        {
+            continue;
+        }
+
+        if (! visitor.apply(boxes.index[i], boxes.index[j]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Visits, for each section of a collection, in order, the boxes (stored
+// with sweep dimension 0) overlapping (or touching) its box, in the order
+// in which they are stored. The collection is scanned once, without
+// copying or sorting it. If Swap is true, the visitor is called with the
+// index of the box first. Returns false if the visitor interrupted.
+template <bool Swap, typename Sections, typename Boxes, typename Visitor>
+inline bool scan_overlapping(Sections const& sections, Boxes const& boxes,
+            Visitor& visitor)
+{
+    std::size_t const count = boxes.size();
+    for (std::size_t i = 0; i < boost::size(sections); i++)
+    {
+        typename boost::range_value<Sections>::type::box_type const& box
+            = sections[i].bounding_box;
+        for (std::size_t j = 0; j < count; j++)
+        {
+            if (boxes.sweep_max[j] < get<min_corner, 0>(box)
+                || boxes.sweep_min[j] > get<max_corner, 0>(box)
+                || boxes.other_max[j] < get<min_corner, 1>(box)
+                || boxes.other_min[j] > get<max_corner, 1>(box))
+            {
+                continue;
+            }
+
+            if (! (Swap
+                   ? visitor.apply(boxes.index[j], i)
+                   : visitor.apply(i, boxes.index[j])))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Visits all pairs of different section indices having overlapping
+// (or touching) boxes within one collection
+template <typename Boxes, typename Visitor>
+inline bool visit_overlapping(Boxes const& boxes, Visitor& visitor)
+{
+    std::size_t const count = boxes.size();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (! sweep_one_box(boxes, i, i + 1, visitor))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Collects pairs of section indices, the smallest index first if Ordered
+template <bool Ordered>
+struct section_pair_collector
+{
+    std::vector<std::pair<std::size_t, std::size_t> > pairs;
+
+    inline bool apply(std::size_t index1, std::size_t index2)
+    {
+        if (Ordered && index2 < index1)
+        {
+            pairs.push_back(std::make_pair(index2, index1));
+        }
+        else
+        {
+            pairs.push_back(std::make_pair(index1, index2));
+        }
+        return true;
+    }
+
+    // Visits the collected pairs of sections, in order of their indices.
+    // That is the order in which partition visits a small number of
+    // sections, so the order of the turns does not depend on the way
+    // overlapping sections are found.
+    template <typename Sections1, typename Sections2, typename Visitor>
+    inline bool visit(Sections1 const& sections1, Sections2 const& sections2,
+                      Visitor& visitor)
+    {
+        std::sort(pairs.begin(), pairs.end());
+        for (std::size_t i = 0; i < pairs.size(); i++)
+        {
+            if (! visitor.apply(sections1[pairs[i].first],
+                                sections2[pairs[i].second]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Passes pairs of section indices to the visitor as pairs of sections
+template <typename Sections1, typename Sections2, typename Visitor>
+struct section_index_visitor
+{
+    Sections1 const& m_sections1;
+    Sections2 const& m_sections2;
+    Visitor& m_visitor;
+
+    inline section_index_visitor(Sections1 const& sections1,
+            Sections2 const& sections2, Visitor& visitor)
+        : m_sections1(sections1)
+        , m_sections2(sections2)
+        , m_visitor(visitor)
+    {}
+
+    inline bool apply(std::size_t index1, std::size_t index2)
+    {
+        return m_visitor.apply(m_sections1[index1], m_sections2[index2]);
+    }
+};
+
+// Visits all pairs of sections having overlapping boxes, using partition.
+// Returns false if the visitor interrupted the process.
+template <typename CSTag>
+struct visit_sections
+{
+    template <typename Sections, typename Visitor>
+    static inline bool apply(Sections const& sections1,
+            Sections const& sections2, Visitor& visitor)
+    {
+        return geometry::partition
+            <
+                typename Sections::box_type,
+                get_section_box,
+                overlaps_section_box
+            >::apply(sections1, sections2, visitor);
+    }
+
+    template <typename Sections, typename Visitor>
+    static inline bool apply(Sections const& sections, Visitor& visitor)
+    {
+        return geometry::partition
+            <
+                typename Sections::box_type,
+                get_section_box,
+                overlaps_section_box
+            >::apply(sections, visitor);
+    }
+};
+
+// For cartesian sections, if partition would compare all pairs (because
+// one of the collections is small, for example a box against a large
+// polygon), the boxes of the small collection are stored consecutively
+// and the large collection is scanned once. Otherwise partition is used,
+// which divides the sections themselves: for two large collections the
+// boxes are not stored as arrays.
+// Sections of one collection (self turns) are swept. For a large
+// collection that is done event by event, such that the visitor is called
+// while sweeping and can stop the process at the first pair of interest.
+template <>
+struct visit_sections<cartesian_tag>
+{
+    // The number of sections below which partition compares all pairs
+    static std::size_t const min_elements = 16;
+
+    template <typename Sections, typename Visitor>
+    static inline bool apply(Sections const& sections1,
+            Sections const& sections2, Visitor& visitor)
+    {
+        std::size_t const count1 = boost::size(sections1);
+        std::size_t const count2 = boost::size(sections2);
+        if (count1 > min_elements && count2 > min_elements)
+        {
+            return visit_sections<void>::apply(sections1, sections2, visitor);
+        }
+
+        typedef typename coordinate_type
+            <
+                typename Sections::box_type
+            >::type coordinate_type;
+
+        section_boxes<coordinate_type> boxes;
+        if (count2 <= count1)
+        {
+            // The pairs are found in order of sections1, then of sections2,
+            // which is the order of partition: they are visited directly
+            boxes.assign(sections2, 0, false);
+            section_index_visitor
+                <
+                    Sections, Sections, Visitor
+                > index_visitor(sections1, sections2, visitor);
+            return scan_overlapping<false>(sections1, boxes, index_visitor);
+        }
+
+        boxes.assign(sections1, 0, false);
+        section_pair_collector<false> collector;
+        scan_overlapping<true>(sections2, boxes, collector);
+        return collector.visit(sections1, sections2, visitor);
+    }
+
+    template <typename Sections, typename Visitor>
+    static inline bool apply(Sections const& sections, Visitor& visitor)
+    {
+        if (boost::size(sections) > min_elements)
+        {
+            return sweep_sections(sections, sweep_dimension(sections),
+                                  visitor);
+        }
+
+        typedef typename coordinate_type
+            <
+                typename Sections::box_type
+            >::type coordinate_type;
+
+        section_boxes<coordinate_type> boxes;
+        boxes.assign(sections, sweep_dimension(sections));
+
+        section_pair_collector<true> collector;
+        visit_overlapping(boxes, collector);
+        return collector.visit(sections, sections, visitor);
+    }
+};
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_BOXES_HPP
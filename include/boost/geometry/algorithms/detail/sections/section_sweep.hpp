@@ -0,0 +1,397 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/algorithms/detail/sweep.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// An event of the sweep over the boxes of sections: the box of a section
+// starts (its minimum) or ends (its maximum) in the sweep dimension
+template <typename CoordinateType>
+struct section_sweep_event
+{
+    CoordinateType time;
+    std::size_t index;
+    bool start_event;
+
+    inline section_sweep_event(CoordinateType const& t, std::size_t i,
+                               bool start = true)
+        : time(t)
+        , index(i)
+        , start_event(start)
+    {}
+
+    inline bool operator<(section_sweep_event const& other) const
+    {
+        if (time != other.time)
+        {
+            return time < other.time;
+        }
+        // A start-event is before an end-event with the same event time,
+        // such that touching boxes are reported
+        if (start_event != other.start_event)
+        {
+            return start_event;
+        }
+        return index < other.index;
+    }
+};
+
+template <typename Event>
+struct section_sweep_event_greater
+{
+    inline bool operator()(Event const& event1, Event const& event2) const
+    {
+        return event2 < event1;
+    }
+};
+
+
+// The queue of the sweep. The start events are known beforehand and are
+// sorted once. The end events are kept in a heap, which therefore never
+// contains more events than the number of active sections.
+template <typename Event>
+class section_sweep_queue
+{
+public :
+    typedef Event value_type;
+
+    inline section_sweep_queue()
+        : m_next(0)
+    {}
+
+    // Takes the start events (leaving the input empty)
+    inline void assign(std::vector<Event>& start_events)
+    {
+        m_start_events.swap(start_events);
+        std::sort(m_start_events.begin(), m_start_events.end());
+        m_next = 0;
+    }
+
+    inline bool empty() const
+    {
+        return m_next == m_start_events.size() && m_end_events.empty();
+    }
+
+    inline Event const& top() const
+    {
+        return next_is_start()
+            ? m_start_events[m_next]
+            : m_end_events.top();
+    }
+
+    inline void pop()
+    {
+        if (next_is_start())
+        {
+            m_next++;
+        }
+        else
+        {
+            m_end_events.pop();
+        }
+    }
+
+    inline void push(Event const& event)
+    {
+        m_end_events.push(event);
+    }
+
+private :
+    inline bool next_is_start() const
+    {
+        return m_next < m_start_events.size()
+            && (m_end_events.empty()
+                || m_start_events[m_next] < m_end_events.top());
+    }
+
+    std::vector<Event> m_start_events;
+    std::size_t m_next;
+    std::priority_queue
+        <
+            Event,
+            std::vector<Event>,
+            section_sweep_event_greater<Event>
+        > m_end_events;
+};
+
+
+template <std::size_t SweepDimension>
+struct section_sweep_initialization_visitor
+{
+    template <typename Sections, typename Queue, typename EventVisitor>
+    static inline void apply(Sections const& sections,
+                             Queue& queue,
+                             EventVisitor&)
+    {
+        typedef typename Queue::value_type event_type;
+
+        BOOST_GEOMETRY_ASSERT(queue.empty());
+
+        // Only the start events are inserted, an end event is inserted
+        // when its start event is processed
+        std::vector<event_type> events;
+        events.reserve(boost::size(sections));
+        for (std::size_t i = 0; i < boost::size(sections); i++)
+        {
+            events.push_back(event_type(
+                get<min_corner, SweepDimension>(sections[i].bounding_box), i));
+        }
+
+        queue.assign(events);
+    }
+};
+
+
+// An active section: its index and the interval of its box in the other
+// dimension (kept here such that the sections are not accessed while
+// searching). Ordered on the minimum of the interval.
+template <typename CoordinateType>
+struct section_sweep_active
+{
+    CoordinateType min_value;
+    CoordinateType max_value;
+    std::size_t index;
+
+    inline section_sweep_active(CoordinateType const& min_v,
+                                CoordinateType const& max_v, std::size_t i)
+        : min_value(min_v)
+        , max_value(max_v)
+        , index(i)
+    {}
+
+    inline bool operator<(section_sweep_active const& other) const
+    {
+        if (min_value != other.min_value)
+        {
+            return min_value < other.min_value;
+        }
+        return index < other.index;
+    }
+};
+
+
+// Keeps the sections whose boxes contain the current sweep position,
+// ordered on the minimum of their box in the other dimension. A new section
+// is only compared with the active sections whose minimum lies within its
+// box, extended by the largest extent of the active sections. So for many
+// sections crossing the sweep line (for example the rows of a lawnmower
+// track) only the few sections near the new one are compared.
+template <std::size_t SweepDimension, typename Sections, typename Visitor>
+class section_sweep_event_visitor
+{
+    static std::size_t const other_dimension = 1 - SweepDimension;
+
+    typedef typename boost::range_value<Sections>::type::box_type box_type;
+    typedef typename coordinate_type<box_type>::type coordinate_type;
+    typedef section_sweep_active<coordinate_type> active_type;
+    typedef typename std::vector<active_type>::iterator active_iterator;
+
+public :
+    inline section_sweep_event_visitor(Sections const& sections,
+                                       Visitor& visitor)
+        : m_sections(sections)
+        , m_visitor(visitor)
+        , m_extent(0)
+        , m_extent_count(0)
+        , m_interrupted(false)
+    {}
+
+    template <typename Event, typename Queue>
+    inline void apply(Event const& event, Queue& queue)
+    {
+        box_type const& box = m_sections[event.index].bounding_box;
+        active_type const active(get<min_corner, other_dimension>(box),
+                                 get<max_corner, other_dimension>(box),
+                                 event.index);
+
+        if (! event.start_event)
+        {
+            remove(active);
+            return;
+        }
+
+        // Active sections starting before the new section, minus the
+        // largest extent, end before it. Active sections starting after
+        // its maximum are beyond it.
+        for (active_iterator it = std::lower_bound(m_active.begin(),
+                m_active.end(),
+                active_type(active.min_value - m_extent,
+                            active.min_value - m_extent, 0));
+             it != m_active.end() && ! (active.max_value < it->min_value);
+             ++it)
+        {
+            if (it->max_value < active.min_value)
+            {
+                continue;
+            }
+
+            // The section with the smallest index is passed first
+            std::size_t const other = it->index;
+            bool const proceed = other < event.index
+                ? m_visitor.apply(m_sections[other], m_sections[event.index])
+                : m_visitor.apply(m_sections[event.index], m_sections[other]);
+            if (! proceed)
+            {
+                m_interrupted = true;
+                return;
+            }
+        }
+
+        insert(active);
+        queue.push(Event(get<max_corner, SweepDimension>(box),
+                         event.index, false));
+    }
+
+    inline bool interrupted() const
+    {
+        return m_interrupted;
+    }
+
+private :
+    inline void insert(active_type const& active)
+    {
+        m_active.insert(std::upper_bound(m_active.begin(), m_active.end(),
+                                         active),
+                        active);
+        add_extent(active.max_value - active.min_value);
+    }
+
+    inline void remove(active_type const& active)
+    {
+        active_iterator it = std::lower_bound(m_active.begin(),
+                                              m_active.end(), active);
+        BOOST_GEOMETRY_ASSERT(it != m_active.end() && it->index == active.index);
+        m_active.erase(it);
+
+        if (active.max_value - active.min_value == m_extent
+            && --m_extent_count == 0)
+        {
+            // The largest extent is not active anymore, find the next one
+            for (std::size_t i = 0; i < m_active.size(); i++)
+            {
+                add_extent(m_active[i].max_value - m_active[i].min_value);
+            }
+        }
+    }
+
+    inline void add_extent(coordinate_type const& extent)
+    {
+        if (m_extent_count == 0 || extent > m_extent)
+        {
+            m_extent = extent;
+            m_extent_count = 1;
+        }
+        else if (extent == m_extent)
+        {
+            m_extent_count++;
+        }
+    }
+
+    Sections const& m_sections;
+    Visitor& m_visitor;
+    std::vector<active_type> m_active;
+    coordinate_type m_extent;
+    std::size_t m_extent_count;
+    bool m_interrupted;
+};
+
+
+template <typename EventVisitor>
+struct section_sweep_interrupt_policy
+{
+    static bool const enabled = true;
+
+    EventVisitor const& m_event_visitor;
+
+    explicit inline section_sweep_interrupt_policy(EventVisitor const& v)
+        : m_event_visitor(v)
+    {}
+
+    template <typename Event>
+    inline bool apply(Event const&) const
+    {
+        return m_event_visitor.interrupted();
+    }
+};
+
+
+template <std::size_t SweepDimension, typename Sections, typename Visitor>
+inline bool sweep_sections(Sections const& sections, Visitor& visitor)
+{
+    typedef typename coordinate_type
+        <
+            typename boost::range_value<Sections>::type::box_type
+        >::type coordinate_type;
+
+    typedef section_sweep_event<coordinate_type> event_type;
+
+    section_sweep_queue<event_type> queue;
+
+    typedef section_sweep_event_visitor
+        <
+            SweepDimension, Sections, Visitor
+        > event_visitor_type;
+
+    section_sweep_initialization_visitor<SweepDimension> init_visitor;
+    event_visitor_type event_visitor(sections, visitor);
+    section_sweep_interrupt_policy<event_visitor_type>
+        interrupt_policy(event_visitor);
+
+    geometry::sweep(sections, queue, init_visitor, event_visitor,
+                    interrupt_policy);
+
+    return ! event_visitor.interrupted();
+}
+
+
+// Visits all pairs of different sections, within one collection of 2D
+// sections, having overlapping (or touching) boxes. The boxes are swept
+// in the given dimension, in the order of their minimum, and the visitor
+// is called as soon as a pair is found. Returns false if the visitor
+// interrupted the sweep: then the rest of the sections is not processed.
+template <typename Sections, typename Visitor>
+inline bool sweep_sections(Sections const& sections,
+                           std::size_t sweep_dimension,
+                           Visitor& visitor)
+{
+    return sweep_dimension == 0
+        ? sweep_sections<0>(sections, visitor)
+        : sweep_sections<1>(sections, visitor);
+}
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
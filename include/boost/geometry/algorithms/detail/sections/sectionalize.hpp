@@ -34,6 +34,7 @@
 #include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
 #include <boost/geometry/algorithms/detail/interior_iterator.hpp>
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
 #include <boost/geometry/algorithms/detail/ring_identifier.hpp>
@@ -312,6 +313,61 @@ struct box_next_in_section<cartesian_tag>
     }
 };
 
+// Returns the maximum number of segments per section such that the points
+// of two sections, which are compared with each other, fit in the
+// specified number of bytes
+template <typename Point>
+inline std::size_t max_count_for_footprint(std::size_t bytes)
+{
+    std::size_t const points = bytes / (2 * sizeof(Point));
+    return points > 3 ? points - 1 : 2;
+}
+
+// Returns the maximum number of segments per section used for turns.
+// By default this is 10. If BOOST_GEOMETRY_SECTION_FOOTPRINT is defined
+// (in bytes, for example the size of the L1 data cache), it is derived
+// from the size of the points.
+template <typename Point>
+inline std::size_t default_max_count()
+{
+#if defined(BOOST_GEOMETRY_SECTION_FOOTPRINT)
+    return max_count_for_footprint<Point>(BOOST_GEOMETRY_SECTION_FOOTPRINT);
+#else
+    return 10;
+#endif
+}
+
+// Segment filter accepting all segments
+struct no_segment_filter
+{
+    template <typename Point>
+    static inline bool apply(Point const& , Point const& )
+    {
+        return true;
+    }
+};
+
+// Segment filter accepting only segments which are not disjoint from a box,
+// in original (not rescaled) coordinates. Cartesian only.
+template <typename Box>
+struct box_segment_filter
+{
+    explicit box_segment_filter(Box const& box)
+        : m_box(box)
+    {}
+
+    template <typename Point>
+    inline bool apply(Point const& p1, Point const& p2) const
+    {
+        Box segment_box;
+        geometry::envelope(p1, segment_box);
+        geometry::expand(segment_box, p2);
+        return ! detail::disjoint::disjoint_box_box(segment_box, m_box);
+    }
+
+    Box m_box;
+};
+
 /// @brief Helper class to create sections of a part of a range, on the fly
 template
 <
@@ -334,6 +390,30 @@ struct sectionalize_part
                              RobustPolicy const& robust_policy,
                              ring_identifier ring_id,
                              std::size_t max_count)
+    {
+        apply(sections, begin, end, robust_policy, no_segment_filter(),
+              ring_id, max_count);
+    }
+
+    // Segments not accepted by the filter are not added to any section.
+    // Their robust points are not calculated, unless it is necessary to
+    // know if they are duplicate (for the first and last non duplicate
+    // section). If they are not calculated they are counted as non
+    // duplicate, so the non duplicate index is only valid for ranges
+    // of which no segments are filtered out.
+    template
+    <
+        typename Iterator,
+        typename RobustPolicy,
+        typename SegmentFilter,
+        typename Sections
+    >
+    static inline void apply(Sections& sections,
+                             Iterator begin, Iterator end,
+                             RobustPolicy const& robust_policy,
+                             SegmentFilter const& filter,
+                             ring_identifier ring_id,
+                             std::size_t max_count)
     {
         boost::ignore_unused_variable_warning(robust_policy);
 
@@ -363,14 +443,37 @@ struct sectionalize_part
         bool mark_first_non_duplicated = true;
         std::size_t last_non_duplicate_index = sections.size();
 
+        // True if a non duplicate segment, filtered out, follows the last
+        // non duplicate section
+        bool skipped_non_duplicate_last = false;
+
         Iterator it = begin;
         robust_point_type previous_robust_point;
-        geometry::recalculate(previous_robust_point, *it, robust_policy);
-        
+        bool has_previous_robust_point = false;
+
         for(Iterator previous = it++;
             it != end;
             ++previous, ++it, index++)
         {
+            bool const skip = ! filter.apply(*previous, *it);
+            if (skip
+                && ! mark_first_non_duplicated
+                && skipped_non_duplicate_last)
+            {
+                // Skip it without calculating its robust points
+                push_section(sections, section, last_non_duplicate_index);
+                has_previous_robust_point = false;
+                ndi++;
+                continue;
+            }
+
+            if (! has_previous_robust_point)
+            {
+                geometry::recalculate(previous_robust_point, *previous,
+                                      robust_policy);
+                has_previous_robust_point = true;
+            }
+
             robust_point_type current_robust_point;
             geometry::recalculate(current_robust_point, *it, robust_policy);
             model::referring_segment<robust_point_type> robust_segment(
@@ -410,6 +513,19 @@ struct sectionalize_part
                 }
             }
 
+            if (skip)
+            {
+                push_section(sections, section, last_non_duplicate_index);
+                if (! duplicate)
+                {
+                    mark_first_non_duplicated = false;
+                    skipped_non_duplicate_last = true;
+                    ndi++;
+                }
+                previous_robust_point = current_robust_point;
+                continue;
+            }
+
             if (section.count > 0
                 && (! compare_loop
                         <
@@ -418,13 +534,7 @@ struct sectionalize_part
                     || section.count > max_count)
                 )
             {
-                if (! section.duplicate)
-                {
-                    last_non_duplicate_index = sections.size();
-                }
-
-                sections.push_back(section);
-                section = section_type();
+                push_section(sections, section, last_non_duplicate_index);
             }
 
             if (section.count == 0)
@@ -464,26 +574,41 @@ struct sectionalize_part
             if (! duplicate)
             {
                 ndi++;
+                skipped_non_duplicate_last = false;
             }
             previous_robust_point = current_robust_point;
         }
 
         // Add last section if applicable
-        if (section.count > 0)
+        push_section(sections, section, last_non_duplicate_index);
+
+        if (last_non_duplicate_index < sections.size()
+            && ! sections[last_non_duplicate_index].duplicate
+            && ! skipped_non_duplicate_last)
         {
-            if (! section.duplicate)
-            {
-                last_non_duplicate_index = sections.size();
-            }
+            sections[last_non_duplicate_index].is_non_duplicate_last = true;
+        }
+    }
 
-            sections.push_back(section);
+private :
+
+    // Adds the section, if it is not empty, and starts a new one
+    template <typename Sections, typename Section>
+    static inline void push_section(Sections& sections, Section& section,
+                                    std::size_t& last_non_duplicate_index)
+    {
+        if (section.count == 0)
+        {
+            return;
         }
 
-        if (last_non_duplicate_index < sections.size()
-            && ! sections[last_non_duplicate_index].duplicate)
+        if (! section.duplicate)
         {
-            sections[last_non_duplicate_index].is_non_duplicate_last = true;
+            last_non_duplicate_index = sections.size();
         }
+
+        sections.push_back(section);
+        section = Section();
     }
 };
 
@@ -501,10 +626,12 @@ struct sectionalize_range
     <
         typename Range,
         typename RobustPolicy,
+        typename SegmentFilter,
         typename Sections
     >
     static inline void apply(Range const& range,
                              RobustPolicy const& robust_policy,
+                             SegmentFilter const& filter,
                              Sections& sections,
                              ring_identifier ring_id,
                              std::size_t max_count)
@@ -534,7 +661,7 @@ struct sectionalize_range
 
         sectionalize_part<Point, DimensionVector>::apply(sections,
             boost::begin(view), boost::end(view),
-            robust_policy, ring_id, max_count);
+            robust_policy, filter, ring_id, max_count);
     }
 };
 
@@ -549,10 +676,12 @@ struct sectionalize_polygon
     <
         typename Polygon,
         typename RobustPolicy,
+        typename SegmentFilter,
         typename Sections
     >
     static inline void apply(Polygon const& poly,
                 RobustPolicy const& robust_policy,
+                SegmentFilter const& filter,
                 Sections& sections,
                 ring_identifier ring_id, std::size_t max_count)
     {
@@ -564,7 +693,8 @@ struct sectionalize_polygon
         > per_range;
 
         ring_id.ring_index = -1;
-        per_range::apply(exterior_ring(poly), robust_policy, sections, ring_id, max_count);
+        per_range::apply(exterior_ring(poly), robust_policy, filter,
+                         sections, ring_id, max_count);
 
         ring_id.ring_index++;
         typename interior_return_type<Polygon const>::type
@@ -572,7 +702,8 @@ struct sectionalize_polygon
         for (typename detail::interior_iterator<Polygon const>::type
                 it = boost::begin(rings); it != boost::end(rings); ++it, ++ring_id.ring_index)
         {
-            per_range::apply(*it, robust_policy, sections, ring_id, max_count);
+            per_range::apply(*it, robust_policy, filter,
+                             sections, ring_id, max_count);
         }
     }
 };
@@ -584,10 +715,12 @@ struct sectionalize_box
     <
         typename Box,
         typename RobustPolicy,
+        typename SegmentFilter,
         typename Sections
     >
     static inline void apply(Box const& box,
                 RobustPolicy const& robust_policy,
+                SegmentFilter const& filter,
                 Sections& sections,
                 ring_identifier const& ring_id, std::size_t max_count)
     {
@@ -618,7 +751,7 @@ struct sectionalize_box
                 closed, false,
             point_type,
             DimensionVector
-        >::apply(points, robust_policy, sections,
+        >::apply(points, robust_policy, filter, sections,
                  ring_id, max_count);
     }
 };
@@ -630,10 +763,12 @@ struct sectionalize_multi
     <
         typename MultiGeometry,
         typename RobustPolicy,
+        typename SegmentFilter,
         typename Sections
     >
     static inline void apply(MultiGeometry const& multi,
                 RobustPolicy const& robust_policy,
+                SegmentFilter const& filter,
                 Sections& sections, ring_identifier ring_id, std::size_t max_count)
     {
         ring_id.multi_index = 0;
@@ -642,7 +777,7 @@ struct sectionalize_multi
             it != boost::end(multi);
             ++it, ++ring_id.multi_index)
         {
-            Policy::apply(*it, robust_policy, sections, ring_id, max_count);
+            Policy::apply(*it, robust_policy, filter, sections, ring_id, max_count);
         }
     }
 };
@@ -795,32 +930,26 @@ struct sectionalize<multi_linestring_tag, MultiLinestring, Reverse, DimensionVec
 #endif
 
 
-/*!
-    \brief Split a geometry into monotonic sections
-    \ingroup sectionalize
-    \tparam Geometry type of geometry to check
-    \tparam Sections type of sections to create
-    \param geometry geometry to create sections from
-    \param robust_policy policy to handle robustness issues
-    \param sections structure with sections
-    \param source_index index to assign to the ring_identifiers
-    \param max_count maximal number of points per section
-        (defaults to 10, this seems to give the fastest results)
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace sectionalize
+{
 
- */
+// Sectionalizes only the segments accepted by the filter
 template
 <
     bool Reverse,
     typename DimensionVector,
     typename Geometry,
     typename Sections,
-    typename RobustPolicy
+    typename RobustPolicy,
+    typename SegmentFilter
 >
-inline void sectionalize(Geometry const& geometry,
+inline void sectionalize_filtered(Geometry const& geometry,
                 RobustPolicy const& robust_policy,
+                SegmentFilter const& filter,
                 Sections& sections,
-                int source_index = 0,
-                std::size_t max_count = 10)
+                int source_index,
+                std::size_t max_count)
 {
     concepts::check<Geometry const>();
 
@@ -855,9 +984,46 @@ inline void sectionalize(Geometry const& geometry,
             Geometry,
             Reverse,
             DimensionVector
-        >::apply(geometry, robust_policy, sections, ring_id, max_count);
+        >::apply(geometry, robust_policy, filter, sections, ring_id, max_count);
 
-    detail::sectionalize::enlarge_sections(sections);
+    enlarge_sections(sections);
+}
+
+}} // namespace detail::sectionalize
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Split a geometry into monotonic sections
+    \ingroup sectionalize
+    \tparam Geometry type of geometry to check
+    \tparam Sections type of sections to create
+    \param geometry geometry to create sections from
+    \param robust_policy policy to handle robustness issues
+    \param sections structure with sections
+    \param source_index index to assign to the ring_identifiers
+    \param max_count maximal number of points per section
+        (defaults to 10, this seems to give the fastest results)
+
+ */
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy
+>
+inline void sectionalize(Geometry const& geometry,
+                RobustPolicy const& robust_policy,
+                Sections& sections,
+                int source_index = 0,
+                std::size_t max_count = 10)
+{
+    detail::sectionalize::sectionalize_filtered<Reverse, DimensionVector>(
+            geometry, robust_policy,
+            detail::sectionalize::no_segment_filter(),
+            sections, source_index, max_count);
 }
 
 
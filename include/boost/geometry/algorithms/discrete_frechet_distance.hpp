@@ -0,0 +1,266 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace discrete_frechet_distance
+{
+
+
+// The coupling distance of a cell: the largest distance of the best coupling
+// up to the pair of points of the cell, and the pair realizing it
+template <typename Distance>
+struct coupling
+{
+    Distance distance;
+    std::size_t index1;
+    std::size_t index2;
+};
+
+
+template <typename Linestring1, typename Linestring2>
+struct linestring_linestring
+{
+    typedef typename point_type<Linestring1>::type point1_type;
+    typedef typename point_type<Linestring2>::type point2_type;
+
+    // Calculates the coupling distances (Eiter and Mannila) row by row,
+    // keeping only the previous row and the current row in memory, such
+    // that they are accessed sequentially. The comparable distance is used
+    // and the distance of the pair realizing the result is calculated at
+    // the end.
+    template <typename Strategy>
+    static inline typename strategy::distance::services::return_type
+        <
+            Strategy, point1_type, point2_type
+        >::type
+    apply(Linestring1 const& linestring1, Linestring2 const& linestring2,
+          Strategy const& strategy)
+    {
+        typedef typename strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type comparable_strategy_type;
+        typedef typename strategy::distance::services::return_type
+            <
+                comparable_strategy_type, point1_type, point2_type
+            >::type comparable_type;
+        typedef typename strategy::distance::services::return_type
+            <
+                Strategy, point1_type, point2_type
+            >::type return_type;
+        typedef coupling<comparable_type> coupling_type;
+
+        std::size_t const count1 = boost::size(linestring1);
+        std::size_t const count2 = boost::size(linestring2);
+        if (count1 == 0 || count2 == 0)
+        {
+            return return_type(0);
+        }
+
+        comparable_strategy_type const comparable_strategy
+            = strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        std::vector<coupling_type> previous(count2);
+        std::vector<coupling_type> current(count2);
+
+        for (std::size_t i = 0; i < count1; i++)
+        {
+            point1_type const& point1 = range::at(linestring1, i);
+            for (std::size_t j = 0; j < count2; j++)
+            {
+                coupling_type cell;
+                cell.distance = comparable_strategy.apply(point1,
+                                    range::at(linestring2, j));
+                cell.index1 = i;
+                cell.index2 = j;
+
+                if (i > 0 || j > 0)
+                {
+                    // The best of the (up to three) predecessors
+                    coupling_type const* best = NULL;
+                    if (i > 0)
+                    {
+                        best = &previous[j];
+                        if (j > 0 && previous[j - 1].distance < best->distance)
+                        {
+                            best = &previous[j - 1];
+                        }
+                    }
+                    if (j > 0
+                        && (best == NULL || current[j - 1].distance < best->distance))
+                    {
+                        best = &current[j - 1];
+                    }
+
+                    if (cell.distance < best->distance)
+                    {
+                        cell = *best;
+                    }
+                }
+
+                current[j] = cell;
+            }
+            previous.swap(current);
+        }
+
+        coupling_type const& result = previous[count2 - 1];
+        return strategy.apply(range::at(linestring1, result.index1),
+                              range::at(linestring2, result.index2));
+    }
+};
+
+
+}} // namespace detail::discrete_frechet_distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Tag1 = typename tag<Geometry1>::type,
+    typename Tag2 = typename tag<Geometry2>::type
+>
+struct discrete_frechet_distance : not_implemented<Tag1, Tag2>
+{};
+
+template <typename Linestring1, typename Linestring2>
+struct discrete_frechet_distance
+    <
+        Linestring1, Linestring2, linestring_tag, linestring_tag
+    > : detail::discrete_frechet_distance::linestring_linestring
+        <
+            Linestring1, Linestring2
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates the discrete Frechet distance between two linestrings
+    \brief_strategy
+\ingroup discrete_frechet_distance
+\details The discrete Frechet distance is the smallest, over all couplings
+    of the points of the linestrings in their order, of the largest
+    distance between coupled points. It measures the similarity of two
+    linestrings, taking their direction into account.
+    It takes O(n*m) time and O(m) memory.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy \tparam_strategy{Point-point distance}
+\param geometry1 \param_geometry (linestring)
+\param geometry2 \param_geometry (linestring)
+\param strategy \param_strategy{point-point distance}
+\return \return_calc{discrete Frechet distance}
+
+\qbk{distinguish,with strategy}
+ */
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline typename strategy::distance::services::return_type
+    <
+        Strategy,
+        typename point_type<Geometry1>::type,
+        typename point_type<Geometry2>::type
+    >::type
+discrete_frechet_distance(Geometry1 const& geometry1,
+                          Geometry2 const& geometry2,
+                          Strategy const& strategy)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+
+    detail::throw_on_empty_input(geometry1);
+    detail::throw_on_empty_input(geometry2);
+
+    return dispatch::discrete_frechet_distance
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, strategy);
+}
+
+
+/*!
+\brief Calculates the discrete Frechet distance between two linestrings
+\ingroup discrete_frechet_distance
+\details The discrete Frechet distance is the smallest, over all couplings
+    of the points of the linestrings in their order, of the largest
+    distance between coupled points. It measures the similarity of two
+    linestrings, taking their direction into account.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry (linestring)
+\param geometry2 \param_geometry (linestring)
+\return \return_calc{discrete Frechet distance}
+ */
+template <typename Geometry1, typename Geometry2>
+inline typename strategy::distance::services::return_type
+    <
+        typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag,
+                typename point_type<Geometry1>::type,
+                typename point_type<Geometry2>::type
+            >::type,
+        typename point_type<Geometry1>::type,
+        typename point_type<Geometry2>::type
+    >::type
+discrete_frechet_distance(Geometry1 const& geometry1,
+                          Geometry2 const& geometry2)
+{
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag,
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type
+        >::type strategy_type;
+
+    return geometry::discrete_frechet_distance(geometry1, geometry2,
+                                               strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
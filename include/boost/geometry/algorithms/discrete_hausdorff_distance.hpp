@@ -0,0 +1,373 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
+
+
+#include <cstddef>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/closest_feature/closest_pair.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace discrete_hausdorff_distance
+{
+
+
+// Keeps the largest of the smallest distances found so far, and the pair of
+// points realizing it
+template <typename Point1, typename Point2, typename Distance>
+struct state
+{
+    typedef Distance distance_type;
+
+    bool found;
+    Distance max;
+    Point1 point1;
+    Point2 point2;
+
+    inline state()
+        : found(false)
+        , max(0)
+    {}
+};
+
+
+// Calculates the directed Hausdorff distance from the points of range1 to
+// the points of range2, the largest distance from a point of range1 to its
+// closest point in range2
+struct directed
+{
+    // Cartesian: the closest point is found by querying an r-tree
+    template
+    <
+        typename Range1,
+        typename Range2,
+        typename ComparableStrategy,
+        typename State
+    >
+    static inline void apply(Range1 const& range1, Range2 const& range2,
+                             ComparableStrategy const& strategy,
+                             State& state, boost::mpl::true_)
+    {
+        typedef typename boost::range_value<Range2>::type point2_type;
+        typedef index::rtree<point2_type, index::linear<8> > rtree_type;
+
+        rtree_type const rtree(boost::begin(range2), boost::end(range2));
+
+        for (typename boost::range_iterator<Range1 const>::type
+                it = boost::begin(range1); it != boost::end(range1); ++it)
+        {
+            point2_type closest;
+            rtree.query(index::nearest(*it, 1), &closest);
+
+            typename State::distance_type const dist
+                = strategy.apply(*it, closest);
+            update(state, dist, *it, closest);
+        }
+    }
+
+    // Other coordinate systems: the points of range2 are visited for each
+    // point of range1, and the visit is stopped (early break) as soon as a
+    // point is closer than the current maximum, because then the point of
+    // range1 cannot increase the maximum
+    template
+    <
+        typename Range1,
+        typename Range2,
+        typename ComparableStrategy,
+        typename State
+    >
+    static inline void apply(Range1 const& range1, Range2 const& range2,
+                             ComparableStrategy const& strategy,
+                             State& state, boost::mpl::false_)
+    {
+        typedef typename boost::range_iterator<Range2 const>::type iterator2;
+
+        for (typename boost::range_iterator<Range1 const>::type
+                it = boost::begin(range1); it != boost::end(range1); ++it)
+        {
+            typename State::distance_type dist_min = 0;
+            iterator2 it_min = boost::begin(range2);
+            bool first = true;
+            bool broken = false;
+            for (iterator2 it2 = boost::begin(range2);
+                 it2 != boost::end(range2); ++it2)
+            {
+                typename State::distance_type const dist
+                    = strategy.apply(*it, *it2);
+                if (first || dist < dist_min)
+                {
+                    first = false;
+                    dist_min = dist;
+                    it_min = it2;
+                    if (state.found && dist_min < state.max)
+                    {
+                        broken = true;
+                        break;
+                    }
+                }
+            }
+
+            if (! broken)
+            {
+                update(state, dist_min, *it, *it_min);
+            }
+        }
+    }
+
+private :
+    template <typename State, typename Distance, typename Point1, typename Point2>
+    static inline void update(State& state, Distance const& dist,
+                              Point1 const& point1, Point2 const& point2)
+    {
+        if (! state.found || state.max < dist)
+        {
+            state.found = true;
+            state.max = dist;
+            state.point1 = point1;
+            state.point2 = point2;
+        }
+    }
+};
+
+
+template <typename Range1, typename Range2>
+struct range_range
+{
+    typedef typename boost::range_value<Range1>::type point1_type;
+    typedef typename boost::range_value<Range2>::type point2_type;
+
+    template <typename Strategy>
+    static inline typename strategy::distance::services::return_type
+        <
+            Strategy, point1_type, point2_type
+        >::type
+    apply(Range1 const& range1, Range2 const& range2,
+          Strategy const& strategy)
+    {
+        typedef typename strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type comparable_strategy_type;
+        typedef typename strategy::distance::services::return_type
+            <
+                comparable_strategy_type, point1_type, point2_type
+            >::type comparable_type;
+        typedef detail::closest_feature::is_squared_cartesian
+            <
+                comparable_strategy_type
+            > use_rtree;
+
+        typedef typename strategy::distance::services::return_type
+            <
+                Strategy, point1_type, point2_type
+            >::type return_type;
+
+        if (boost::empty(range1) || boost::empty(range2))
+        {
+            return return_type(0);
+        }
+
+        comparable_strategy_type const comparable_strategy
+            = strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        state<point1_type, point2_type, comparable_type> forward;
+        state<point2_type, point1_type, comparable_type> backward;
+
+        directed::apply(range1, range2, comparable_strategy, forward,
+                        use_rtree());
+
+        // Only points further away than the maximum found in the first
+        // direction are of interest in the second direction
+        backward.found = true;
+        backward.max = forward.max;
+        directed::apply(range2, range1, comparable_strategy, backward,
+                        use_rtree());
+
+        return forward.max < backward.max
+            ? strategy.apply(backward.point2, backward.point1)
+            : strategy.apply(forward.point1, forward.point2);
+    }
+};
+
+
+}} // namespace detail::discrete_hausdorff_distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Tag1 = typename tag<Geometry1>::type,
+    typename Tag2 = typename tag<Geometry2>::type
+>
+struct discrete_hausdorff_distance : not_implemented<Tag1, Tag2>
+{};
+
+template <typename Linestring1, typename Linestring2>
+struct discrete_hausdorff_distance
+    <
+        Linestring1, Linestring2, linestring_tag, linestring_tag
+    > : detail::discrete_hausdorff_distance::range_range
+        <
+            Linestring1, Linestring2
+        >
+{};
+
+template <typename MultiPoint1, typename MultiPoint2>
+struct discrete_hausdorff_distance
+    <
+        MultiPoint1, MultiPoint2, multi_point_tag, multi_point_tag
+    > : detail::discrete_hausdorff_distance::range_range
+        <
+            MultiPoint1, MultiPoint2
+        >
+{};
+
+template <typename Linestring, typename MultiPoint>
+struct discrete_hausdorff_distance
+    <
+        Linestring, MultiPoint, linestring_tag, multi_point_tag
+    > : detail::discrete_hausdorff_distance::range_range
+        <
+            Linestring, MultiPoint
+        >
+{};
+
+template <typename MultiPoint, typename Linestring>
+struct discrete_hausdorff_distance
+    <
+        MultiPoint, Linestring, multi_point_tag, linestring_tag
+    > : detail::discrete_hausdorff_distance::range_range
+        <
+            MultiPoint, Linestring
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates the discrete Hausdorff distance between two geometries
+    \brief_strategy
+\ingroup discrete_hausdorff_distance
+\details The discrete Hausdorff distance is the largest distance of any
+    point of one of the geometries to the closest point of the other
+    geometry, considering only the points (vertices) of the geometries.
+    For cartesian geometries the closest points are found using an r-tree.
+    For other coordinate systems the search for the closest point is
+    stopped as soon as a point closer than the largest distance found so
+    far is encountered.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy \tparam_strategy{Point-point distance}
+\param geometry1 \param_geometry (linestring or multi-point)
+\param geometry2 \param_geometry (linestring or multi-point)
+\param strategy \param_strategy{point-point distance}
+\return \return_calc{discrete Hausdorff distance}
+
+\qbk{distinguish,with strategy}
+ */
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline typename strategy::distance::services::return_type
+    <
+        Strategy,
+        typename point_type<Geometry1>::type,
+        typename point_type<Geometry2>::type
+    >::type
+discrete_hausdorff_distance(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Strategy const& strategy)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+
+    detail::throw_on_empty_input(geometry1);
+    detail::throw_on_empty_input(geometry2);
+
+    return dispatch::discrete_hausdorff_distance
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, strategy);
+}
+
+
+/*!
+\brief Calculates the discrete Hausdorff distance between two geometries
+\ingroup discrete_hausdorff_distance
+\details The discrete Hausdorff distance is the largest distance of any
+    point of one of the geometries to the closest point of the other
+    geometry, considering only the points (vertices) of the geometries.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry (linestring or multi-point)
+\param geometry2 \param_geometry (linestring or multi-point)
+\return \return_calc{discrete Hausdorff distance}
+ */
+template <typename Geometry1, typename Geometry2>
+inline typename strategy::distance::services::return_type
+    <
+        typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag,
+                typename point_type<Geometry1>::type,
+                typename point_type<Geometry2>::type
+            >::type,
+        typename point_type<Geometry1>::type,
+        typename point_type<Geometry2>::type
+    >::type
+discrete_hausdorff_distance(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2)
+{
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag,
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type
+        >::type strategy_type;
+
+    return geometry::discrete_hausdorff_distance(geometry1, geometry2,
+                                                 strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
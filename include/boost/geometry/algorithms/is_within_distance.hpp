@@ -0,0 +1,332 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_IS_WITHIN_DISTANCE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_IS_WITHIN_DISTANCE_HPP
+
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/iterators/segment_iterator.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/detail/closest_feature/closest_pair.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/linear_areal.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_within_distance
+{
+
+// Geometries consisting of segments, of which the segment distances are
+// compared one by one
+template <typename Tag> struct has_segments : boost::mpl::false_ {};
+template <> struct has_segments<linestring_tag> : boost::mpl::true_ {};
+template <> struct has_segments<multi_linestring_tag> : boost::mpl::true_ {};
+template <> struct has_segments<ring_tag> : boost::mpl::true_ {};
+template <> struct has_segments<polygon_tag> : boost::mpl::true_ {};
+template <> struct has_segments<multi_polygon_tag> : boost::mpl::true_ {};
+
+
+template <typename Tag> struct is_areal : boost::mpl::false_ {};
+template <> struct is_areal<ring_tag> : boost::mpl::true_ {};
+template <> struct is_areal<polygon_tag> : boost::mpl::true_ {};
+template <> struct is_areal<multi_polygon_tag> : boost::mpl::true_ {};
+
+
+// Returns true if (part of) geometry1 is inside areal geometry2, assuming
+// their boundaries do not intersect
+template <bool Areal2>
+struct inside_areal
+{
+    template <typename Geometry1, typename Geometry2>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2)
+    {
+        return ! detail::disjoint::disjoint_no_intersections_policy
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2);
+    }
+};
+
+template <>
+struct inside_areal<false>
+{
+    template <typename Geometry1, typename Geometry2>
+    static inline bool apply(Geometry1 const& , Geometry2 const& )
+    {
+        return false;
+    }
+};
+
+
+// Calculates the comparable distance, and compares it to the maximum
+struct by_distance
+{
+    template
+    <
+        typename Geometry1,
+        typename Geometry2,
+        typename Strategy,
+        typename ComparableStrategy,
+        typename Distance
+    >
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& strategy,
+                             ComparableStrategy const& ,
+                             Distance const& max_distance)
+    {
+        return ! (max_distance
+                < geometry::comparable_distance(geometry1, geometry2, strategy));
+    }
+};
+
+
+// Compares the distances of the segments, returning as soon as a pair of
+// segments within the maximum distance is found. The segments are
+// visited by a branch-and-bound traversal of hierarchies of both
+// geometries, skipping pairs of boxes further away than the maximum.
+// If there are no such segments, the geometries can still be within
+// distance if one is inside the other.
+struct by_segments
+{
+    template
+    <
+        typename Geometry1,
+        typename Geometry2,
+        typename Strategy,
+        typename ComparableStrategy,
+        typename Distance
+    >
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& ,
+                             ComparableStrategy const& comparable_strategy,
+                             Distance const& max_distance)
+    {
+        if (detail::closest_feature::closest_pair::within(
+                geometry::segments_begin(geometry1),
+                geometry::segments_end(geometry1),
+                geometry::segments_begin(geometry2),
+                geometry::segments_end(geometry2),
+                comparable_strategy, max_distance))
+        {
+            return true;
+        }
+
+        return inside_areal
+                <
+                    is_areal<typename tag<Geometry2>::type>::value
+                >::apply(geometry1, geometry2)
+            || inside_areal
+                <
+                    is_areal<typename tag<Geometry1>::type>::value
+                >::apply(geometry2, geometry1);
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+struct is_within_distance
+{
+    typedef typename strategy::distance::services::comparable_type
+        <
+            Strategy
+        >::type comparable_strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            comparable_strategy_type,
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type
+        >::type comparable_return_type;
+
+    // Boxes, and pairs of features, can be compared by their squared
+    // cartesian distance
+    typedef detail::closest_feature::is_squared_cartesian
+        <
+            comparable_strategy_type
+        > squared_cartesian;
+
+    template <typename T>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             T const& max_distance,
+                             Strategy const& strategy)
+    {
+        if (geometry::is_empty(geometry1) || geometry::is_empty(geometry2))
+        {
+            return false;
+        }
+
+        // A distance is never negative. Check this before the conversion
+        // to a comparable distance, which can square it
+        if (max_distance < T(0))
+        {
+            return false;
+        }
+
+        comparable_strategy_type const comparable_strategy
+            = strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        comparable_return_type const comparable_max
+            = strategy::distance::services::result_from_distance
+                <
+                    comparable_strategy_type,
+                    typename point_type<Geometry1>::type,
+                    typename point_type<Geometry2>::type
+                >::apply(comparable_strategy, max_distance);
+
+        if (BOOST_GEOMETRY_CONDITION(squared_cartesian::value)
+            && envelopes_too_far(geometry1, geometry2, comparable_max))
+        {
+            return false;
+        }
+
+        typedef typename boost::mpl::if_c
+            <
+                boost::mpl::and_
+                    <
+                        squared_cartesian,
+                        has_segments<typename tag<Geometry1>::type>,
+                        has_segments<typename tag<Geometry2>::type>
+                    >::value,
+                by_segments,
+                by_distance
+            >::type policy;
+
+        return policy::apply(geometry1, geometry2, strategy,
+                             comparable_strategy, comparable_max);
+    }
+
+private :
+
+    static inline bool envelopes_too_far(Geometry1 const& geometry1,
+                                         Geometry2 const& geometry2,
+                                         comparable_return_type const& max)
+    {
+        typedef model::box<typename point_type<Geometry1>::type> box1_type;
+        typedef model::box<typename point_type<Geometry2>::type> box2_type;
+
+        box1_type box1;
+        box2_type box2;
+        geometry::envelope(geometry1, box1);
+        geometry::envelope(geometry2, box2);
+
+        return max < detail::closest_feature::box_box_squared_distance
+            <
+                box1_type, box2_type, 0, dimension<box1_type>::value
+            >::template apply<comparable_return_type>(box1, box2);
+    }
+};
+
+
+}} // namespace detail::is_within_distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks if two geometries are within a specified distance of each
+    other \brief_strategy
+\ingroup is_within_distance
+\details The function is_within_distance returns the same as comparing the
+    distance of the two geometries with the specified distance, but it can
+    return as soon as it is known: if the envelopes are further away, or
+    for linear and areal cartesian geometries, if a pair of segments within
+    that distance is found.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam T numerical type of the distance
+\tparam Strategy \tparam_strategy{Distance}
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param max_distance The maximum distance
+\param strategy \param_strategy{distance}
+\return true if the distance between the geometries is not larger than
+    max_distance, false if it is larger or if one of the geometries is empty
+
+\qbk{distinguish,with strategy}
+ */
+template <typename Geometry1, typename Geometry2, typename T, typename Strategy>
+inline bool is_within_distance(Geometry1 const& geometry1,
+                               Geometry2 const& geometry2,
+                               T const& max_distance,
+                               Strategy const& strategy)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+
+    return detail::is_within_distance::is_within_distance
+        <
+            Geometry1, Geometry2, Strategy
+        >::apply(geometry1, geometry2, max_distance, strategy);
+}
+
+
+/*!
+\brief Checks if two geometries are within a specified distance of each
+    other
+\ingroup is_within_distance
+\details The function is_within_distance returns the same as comparing the
+    distance of the two geometries with the specified distance, but it can
+    return as soon as it is known: if the envelopes are further away, or
+    for linear and areal cartesian geometries, if a pair of segments within
+    that distance is found.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam T numerical type of the distance
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param max_distance The maximum distance
+\return true if the distance between the geometries is not larger than
+    max_distance, false if it is larger or if one of the geometries is empty
+ */
+template <typename Geometry1, typename Geometry2, typename T>
+inline bool is_within_distance(Geometry1 const& geometry1,
+                               Geometry2 const& geometry2,
+                               T const& max_distance)
+{
+    return geometry::is_within_distance(geometry1, geometry2, max_distance,
+        typename detail::distance::default_strategy
+            <
+                Geometry1, Geometry2
+            >::type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_IS_WITHIN_DISTANCE_HPP
@@ -275,6 +275,50 @@ inline void union_(Geometry1 const& geometry1,
 }
 
 
+/*!
+\brief Combines two geometries which each other, reusing intermediate containers
+\ingroup union
+\details \details_calc2{union, spatial set theoretic union}.
+    The intermediate results are stored in the specified workspace, such
+    that its allocated capacity can be reused by subsequent calls.
+    This overload is only available for areal geometries.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Collection output collection, either a multi-geometry,
+    or a std::vector<Geometry> / std::deque<Geometry> etc
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+\param workspace overlay_workspace, having the same point type as the output
+\note Called union_ because union is a reserved word.
+
+\qbk{distinguish,with workspace}
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Collection,
+    typename WorkspaceGeometry,
+    typename RobustPolicy
+>
+inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection,
+            overlay_workspace<WorkspaceGeometry, RobustPolicy>& workspace)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+
+    typedef typename boost::range_value<Collection>::type geometry_out;
+    concepts::check<geometry_out>();
+
+    detail::overlay::overlay_insert<geometry_out, overlay_union>(
+            geometry1, geometry2,
+            range::back_inserter(output_collection), workspace);
+}
+
+
 }} // namespace boost::geometry
 
 
@@ -0,0 +1,271 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CASCADED_UNION_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CASCADED_UNION_HPP
+
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_workspace.hpp>
+
+#include <boost/geometry/extensions/algorithms/detail/for_each_index.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace cascaded_union
+{
+
+
+// Unions the inputs, indicated by a range of indices, pairwise in a
+// balanced binary tree. Because the indices are in spatial order,
+// neighbouring inputs (which are likely to interact) are combined first,
+// and each union stays small until the top levels of the tree.
+template <typename Geometries, typename MultiPolygon>
+class cascader
+{
+    typedef std::vector<std::size_t>::const_iterator index_iterator;
+    typedef overlay_workspace<MultiPolygon> workspace_type;
+
+public :
+    inline cascader(Geometries const& geometries)
+        : m_geometries(geometries)
+    {}
+
+    inline void apply(index_iterator first, index_iterator last,
+                MultiPolygon& result)
+    {
+        if (last - first == 1)
+        {
+            // A single input is unioned with itself, such that the
+            // overlapping polygons of a multi-polygon are dissolved
+            geometry::union_(range::at(m_geometries, *first),
+                    range::at(m_geometries, *first),
+                    result, m_workspace);
+            return;
+        }
+        cascade(first, last, result);
+    }
+
+private :
+    inline void cascade(index_iterator first, index_iterator last,
+                MultiPolygon& result)
+    {
+        std::size_t const count = static_cast<std::size_t>(last - first);
+        if (count == 0)
+        {
+            return;
+        }
+        if (count == 1)
+        {
+            // It is unioned with its sibling in the tree
+            geometry::convert(range::at(m_geometries, *first), result);
+            return;
+        }
+        if (count == 2)
+        {
+            geometry::union_(range::at(m_geometries, *first),
+                    range::at(m_geometries, *(first + 1)),
+                    result, m_workspace);
+            return;
+        }
+
+        index_iterator const mid = first + count / 2;
+        MultiPolygon left, right;
+        cascade(first, mid, left);
+        cascade(mid, last, right);
+        geometry::union_(left, right, result, m_workspace);
+    }
+
+    Geometries const& m_geometries;
+
+    // Each cascader (one per thread) has its own workspace
+    workspace_type m_workspace;
+};
+
+
+// Returns the indices of the geometries in the order of the leaves of a
+// packed rtree over their envelopes, such that consecutive indices
+// are spatially close to each other
+template <typename Geometries>
+inline void spatial_order(Geometries const& geometries,
+            std::vector<std::size_t>& indices)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef model::box
+        <
+            typename geometry::point_type<geometry_type>::type
+        > box_type;
+    typedef std::pair<box_type, std::size_t> value_type;
+    typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+
+    std::vector<value_type> values;
+    values.reserve(boost::size(geometries));
+
+    std::size_t index = 0;
+    for (typename boost::range_iterator<Geometries const>::type
+            it = boost::begin(geometries);
+         it != boost::end(geometries);
+         ++it, ++index)
+    {
+        values.push_back(value_type(geometry::return_envelope<box_type>(*it),
+                                    index));
+    }
+
+    // Construction from a range uses the packing algorithm
+    rtree_type const tree(values);
+
+    indices.clear();
+    indices.reserve(values.size());
+    for (typename rtree_type::const_iterator it = tree.begin();
+         it != tree.end(); ++it)
+    {
+        indices.push_back(it->second);
+    }
+}
+
+
+// Cascades one contiguous part of the spatially ordered inputs
+// (an independent subtree) per index
+template <typename Geometries, typename MultiPolygon>
+struct cascade_part_task
+{
+    inline cascade_part_task(Geometries const& geometries,
+                std::vector<std::size_t> const& indices,
+                std::vector<MultiPolygon>& partial)
+        : m_geometries(geometries)
+        , m_indices(indices)
+        , m_partial(partial)
+    {}
+
+    inline void apply(std::size_t i) const
+    {
+        std::size_t const n = m_indices.size();
+        std::size_t const parts = m_partial.size();
+        cascader<Geometries, MultiPolygon> cascade(m_geometries);
+        cascade.apply(m_indices.begin() + i * n / parts,
+                      m_indices.begin() + (i + 1) * n / parts,
+                      m_partial[i]);
+    }
+
+    Geometries const& m_geometries;
+    std::vector<std::size_t> const& m_indices;
+    std::vector<MultiPolygon>& m_partial;
+};
+
+
+template <typename Geometries, typename MultiPolygon>
+inline void apply(Geometries const& geometries, MultiPolygon& result,
+            std::size_t thread_count)
+{
+    std::vector<std::size_t> indices;
+    spatial_order(geometries, indices);
+
+    if (indices.size() < 2 * thread_count)
+    {
+        // Not worth to distribute
+        thread_count = 1;
+    }
+
+    if (thread_count > 1)
+    {
+        // Each thread cascades one part, the partial results are combined
+        // afterwards, by a cascade of their own.
+        std::vector<MultiPolygon> partial(thread_count);
+        detail::parallel::for_each_index(
+            cascade_part_task<Geometries, MultiPolygon>(geometries,
+                    indices, partial),
+            thread_count, thread_count);
+
+        std::vector<std::size_t> partial_indices(thread_count);
+        for (std::size_t i = 0; i < thread_count; i++)
+        {
+            partial_indices[i] = i;
+        }
+        cascader<std::vector<MultiPolygon>, MultiPolygon> cascade(partial);
+        cascade.apply(partial_indices.begin(), partial_indices.end(), result);
+        return;
+    }
+
+    cascader<Geometries, MultiPolygon> cascade(geometries);
+    cascade.apply(indices.begin(), indices.end(), result);
+}
+
+
+}} // namespace detail::cascaded_union
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Unions a collection of areal geometries
+\ingroup overlay
+\details The inputs are ordered spatially (by the leaves of a packed rtree
+    over their envelopes) and unioned pairwise, bottom-up, in a balanced
+    binary tree. This is much faster than adding the geometries one by one
+    to a growing result, which has to be processed again for each input.
+    Independent subtrees can be processed by multiple threads (if the
+    compiler supports C++11 threads, otherwise the union is sequential).
+\tparam Geometries range of polygons or multi-polygons (for example a
+    multi-polygon with overlapping polygons)
+\tparam Collection output collection of polygons, for example a multi-polygon
+\param geometries the geometries to union
+\param output_collection the output collection, the result is appended
+\param thread_count maximum number of threads to use
+*/
+template <typename Geometries, typename Collection>
+inline void cascaded_union(Geometries const& geometries,
+            Collection& output_collection,
+            std::size_t thread_count = 1)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_value<Collection>::type polygon_type;
+
+    concepts::check<geometry_type const>();
+    concepts::check<polygon_type>();
+
+    typedef model::multi_polygon<polygon_type> multi_polygon_type;
+
+    multi_polygon_type result;
+    detail::cascaded_union::apply(geometries, result,
+            thread_count == 0 ? 1 : thread_count);
+
+    for (typename boost::range_iterator<multi_polygon_type const>::type
+            it = boost::begin(result);
+         it != boost::end(result);
+         ++it)
+    {
+        range::push_back(output_collection, *it);
+    }
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CASCADED_UNION_HPP
@@ -0,0 +1,232 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_BY_GRID_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_BY_GRID_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace clip_by_grid
+{
+
+
+// Divides the pieces of a geometry recursively over the cells of a grid.
+// At each level the current block of cells is split into two halves, and
+// only the pieces of the parent block are clipped by the two half blocks.
+// Therefore each vertex is processed about log2(cells) times instead of
+// once per cell. Pieces located completely in one half are passed as is.
+template <typename Box, typename Collection>
+class grid_divider
+{
+    typedef typename boost::range_value<Collection>::type piece_type;
+    typedef typename geometry::point_type<Box>::type point_type;
+    typedef typename geometry::select_most_precise
+        <
+            typename geometry::coordinate_type<Box>::type,
+            double
+        >::type calculation_type;
+
+public :
+    inline grid_divider(Box const& extent,
+                std::size_t columns, std::size_t rows,
+                std::vector<Collection>& cells)
+        : m_extent(extent)
+        , m_columns(columns)
+        , m_rows(rows)
+        , m_cells(cells)
+    {}
+
+    inline void apply(Collection& pieces,
+                std::size_t column_begin, std::size_t column_end,
+                std::size_t row_begin, std::size_t row_end)
+    {
+        if (boost::empty(pieces))
+        {
+            return;
+        }
+
+        std::size_t const column_count = column_end - column_begin;
+        std::size_t const row_count = row_end - row_begin;
+
+        if (column_count == 1 && row_count == 1)
+        {
+            Collection& cell = m_cells[row_begin * m_columns + column_begin];
+            for (typename boost::range_iterator<Collection>::type
+                    it = boost::begin(pieces); it != boost::end(pieces); ++it)
+            {
+                range::push_back(cell, *it);
+            }
+            return;
+        }
+
+        // Split in the direction having most cells
+        Collection lower, upper;
+        if (column_count >= row_count)
+        {
+            std::size_t const mid = column_begin + column_count / 2;
+            divide(pieces,
+                   block(column_begin, mid, row_begin, row_end),
+                   block(mid, column_end, row_begin, row_end),
+                   lower, upper);
+            pieces.clear();
+            apply(lower, column_begin, mid, row_begin, row_end);
+            apply(upper, mid, column_end, row_begin, row_end);
+        }
+        else
+        {
+            std::size_t const mid = row_begin + row_count / 2;
+            divide(pieces,
+                   block(column_begin, column_end, row_begin, mid),
+                   block(column_begin, column_end, mid, row_end),
+                   lower, upper);
+            pieces.clear();
+            apply(lower, column_begin, column_end, row_begin, mid);
+            apply(upper, column_begin, column_end, mid, row_end);
+        }
+    }
+
+private :
+
+    // Returns the coordinate of a grid line. It is calculated from the
+    // index only, such that neighbouring cells share exactly the same border
+    template <std::size_t Dimension>
+    inline calculation_type grid_line(std::size_t index, std::size_t count) const
+    {
+        calculation_type const min = geometry::get<min_corner, Dimension>(m_extent);
+        calculation_type const max = geometry::get<max_corner, Dimension>(m_extent);
+        return index == count ? max : min + (max - min) * index / count;
+    }
+
+    inline Box block(std::size_t column_begin, std::size_t column_end,
+                std::size_t row_begin, std::size_t row_end) const
+    {
+        Box result;
+        geometry::set<min_corner, 0>(result, grid_line<0>(column_begin, m_columns));
+        geometry::set<min_corner, 1>(result, grid_line<1>(row_begin, m_rows));
+        geometry::set<max_corner, 0>(result, grid_line<0>(column_end, m_columns));
+        geometry::set<max_corner, 1>(result, grid_line<1>(row_end, m_rows));
+        return result;
+    }
+
+    inline void divide(Collection const& pieces,
+                Box const& lower_box, Box const& upper_box,
+                Collection& lower, Collection& upper) const
+    {
+        for (typename boost::range_iterator<Collection const>::type
+                it = boost::begin(pieces); it != boost::end(pieces); ++it)
+        {
+            // A piece lying on the shared border (only possible for linear
+            // pieces) is covered by both halves, and passed to both
+            Box const envelope = geometry::return_envelope<Box>(*it);
+            bool const in_lower = geometry::covered_by(envelope, lower_box);
+            bool const in_upper = geometry::covered_by(envelope, upper_box);
+            if (in_lower)
+            {
+                range::push_back(lower, *it);
+            }
+            if (in_upper)
+            {
+                range::push_back(upper, *it);
+            }
+            if (! in_lower && ! in_upper)
+            {
+                geometry::intersection(*it, lower_box, lower);
+                geometry::intersection(*it, upper_box, upper);
+            }
+        }
+    }
+
+    Box const& m_extent;
+    std::size_t m_columns;
+    std::size_t m_rows;
+    std::vector<Collection>& m_cells;
+};
+
+
+}} // namespace detail::clip_by_grid
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Clips a geometry by all cells of a regular grid, in one pass
+\ingroup overlay
+\details The extent is divided into columns x rows cells of equal size.
+    The result for each cell is the same as the intersection of the
+    geometry with the box of that cell, but the geometry is not rescanned
+    for each cell: the grid is bisected recursively, and only the pieces
+    of a block of cells are clipped by its two halves. For linear geometries
+    clipping is done by Liang-Barsky, for areal geometries by the
+    intersection of areal geometries with a box.
+    Therefore linear pieces lying on a grid line are part of the result of
+    the cells at both sides of that line.
+    This is useful for tiling, where one geometry is clipped by many tiles.
+    For a tile pyramid, the cells of one level can be used as input for
+    the next level.
+\tparam Geometry \tparam_geometry, linear or areal
+\tparam Box box type of the extent of the grid
+\tparam Collection collection of linestrings or polygons (for example a
+    multi-linestring or a multi-polygon), to receive the result of one cell
+\param geometry \param_geometry
+\param extent the extent of the grid
+\param columns the number of cells in x direction
+\param rows the number of cells in y direction
+\param cells the output, resized to columns * rows collections. The cell in
+    column i and row j (counted from the minimum corner) has index j * columns + i
+*/
+template <typename Geometry, typename Box, typename Collection>
+inline void clip_by_grid(Geometry const& geometry, Box const& extent,
+            std::size_t columns, std::size_t rows,
+            std::vector<Collection>& cells)
+{
+    concepts::check<Geometry const>();
+    concepts::check<Box const>();
+    concepts::check<typename boost::range_value<Collection>::type>();
+
+    cells.clear();
+    if (columns == 0 || rows == 0)
+    {
+        return;
+    }
+    cells.resize(columns * rows);
+
+    Collection pieces;
+    geometry::intersection(geometry, extent, pieces);
+
+    detail::clip_by_grid::grid_divider<Box, Collection> divider(extent,
+                columns, rows, cells);
+    divider.apply(pieces, 0, columns, 0, rows);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CLIP_BY_GRID_HPP
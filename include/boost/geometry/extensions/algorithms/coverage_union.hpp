@@ -0,0 +1,1201 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COVERAGE_UNION_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COVERAGE_UNION_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/point_on_surface.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/overlay/add_rings.hpp>
+#include <boost/geometry/algorithms/detail/overlay/assign_parents.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
+
+#include <boost/geometry/extensions/algorithms/cascaded_union.hpp>
+
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace coverage_union
+{
+
+
+// Calls the visitor for each polygon of a polygon or multi-polygon
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct polygons
+{
+    typedef Geometry polygon_type;
+
+    template <typename Visitor>
+    static inline void apply(Geometry const& polygon, Visitor& visitor)
+    {
+        visitor.apply(polygon);
+    }
+};
+
+template <typename MultiPolygon>
+struct polygons<MultiPolygon, multi_polygon_tag>
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    template <typename Visitor>
+    static inline void apply(MultiPolygon const& multi_polygon,
+                Visitor& visitor)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon);
+             ++it)
+        {
+            visitor.apply(*it);
+        }
+    }
+};
+
+
+struct coverage_edge
+{
+    inline coverage_edge(std::size_t f, std::size_t t, std::size_t p)
+        : from(f)
+        , to(t)
+        , polygon(p)
+        , component(p)
+        , shared(false)
+    {}
+
+    std::size_t from, to;
+    std::size_t polygon;
+    std::size_t component;
+
+    // True if the edge is cancelled by the same edge, in the opposite
+    // direction, of another polygon (or of the same polygon)
+    bool shared;
+};
+
+
+// The directed edges of all rings of all polygons, between vertices which
+// are identified by their exact coordinates. All rings are oriented such
+// that the interior is at the right side (clockwise exteriors).
+// Edges shared by two polygons occur twice, in opposite directions, and
+// are found by hashing. They are removed and the remaining edges are
+// traced to the rings of the union.
+template <typename Point>
+class coverage_edges
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    typedef std::pair<coordinate_type, coordinate_type> vertex_key;
+    typedef std::pair<std::size_t, std::size_t> edge_key;
+    typedef boost::unordered_map
+        <
+            edge_key, std::size_t, boost::hash<edge_key>
+        > edge_map;
+    typedef typename select_most_precise
+        <
+            coordinate_type,
+            double
+        >::type calculation_type;
+
+    static std::size_t const none = static_cast<std::size_t>(-1);
+    static std::size_t const matched = static_cast<std::size_t>(-2);
+
+public :
+    inline coverage_edges()
+        : m_polygon_count(0)
+    {}
+
+    template <typename Polygon>
+    inline void apply(Polygon const& polygon)
+    {
+        bool const reverse
+            = geometry::point_order<Polygon>::value == counterclockwise;
+        bool const is_open = geometry::closure<Polygon>::value == open;
+
+        add_ring(exterior_ring(polygon), reverse, is_open);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            add_ring(*it, reverse, is_open);
+        }
+
+        m_polygon_count++;
+    }
+
+    inline std::size_t polygon_count() const
+    {
+        return m_polygon_count;
+    }
+
+    // Marks all pairs of opposite edges as shared, and the polygons
+    // sharing an edge as belonging to the same component. Components in
+    // which an edge occurs more than once, in the same direction, are
+    // marked as overlapping.
+    inline void remove_shared_edges()
+    {
+        std::vector<std::size_t> parent(m_polygon_count);
+        for (std::size_t i = 0; i < m_polygon_count; i++)
+        {
+            parent[i] = i;
+        }
+
+        // Per directed edge, the first of a list of unmatched edges
+        // (the list is linked by next), or matched if all are matched
+        edge_map unmatched;
+        unmatched.rehash(m_edges.size());
+        std::vector<std::size_t> next(m_edges.size(), std::size_t(none));
+
+        // Edges occurring twice in the same direction are covered twice at
+        // their right side
+        std::vector<std::size_t> duplicates;
+
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            coverage_edge& edge = m_edges[i];
+
+            typename edge_map::iterator it
+                = unmatched.find(edge_key(edge.to, edge.from));
+
+            if (it != unmatched.end()
+                && it->second != none && it->second != matched)
+            {
+                std::size_t const j = it->second;
+                it->second = next[j] == none ? std::size_t(matched) : next[j];
+                edge.shared = true;
+                m_edges[j].shared = true;
+                unite(parent, edge.polygon, m_edges[j].polygon);
+                continue;
+            }
+
+            bool const reverse_matched
+                = it != unmatched.end() && it->second == matched;
+            std::pair<typename edge_map::iterator, bool> const inserted
+                = unmatched.insert(std::make_pair(
+                    edge_key(edge.from, edge.to), std::size_t(none)));
+            std::size_t& first = inserted.first->second;
+            if (! inserted.second || reverse_matched)
+            {
+                // The same edge is already added (unmatched, or matched)
+                duplicates.push_back(i);
+            }
+            next[i] = first == matched ? std::size_t(none) : first;
+            first = i;
+        }
+
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            m_edges[i].component = find(parent, m_edges[i].polygon);
+        }
+        m_components.resize(m_polygon_count);
+        for (std::size_t i = 0; i < m_polygon_count; i++)
+        {
+            m_components[i] = find(parent, i);
+        }
+
+        m_overlapping.assign(m_polygon_count, false);
+        for (std::size_t i = 0; i < duplicates.size(); i++)
+        {
+            m_overlapping[m_edges[duplicates[i]].component] = true;
+        }
+
+        build_outgoing();
+    }
+
+    // Returns true if polygons of the component (or of any component)
+    // overlap along an edge
+    inline bool overlapping(std::size_t component = none) const
+    {
+        return component == none
+            ? std::find(m_overlapping.begin(), m_overlapping.end(), true)
+                != m_overlapping.end()
+            : bool(m_overlapping[component]);
+    }
+
+    // Splits the remaining edges at vertices of other remaining edges
+    // lying on their interior (T-junctions, where a polygon is not split at
+    // the vertices of its neighbour), and marks the shared edges again.
+    // The vertices are sorted by x, such that for each edge only the
+    // vertices within its x-range are checked. Returns false if no edge
+    // was split.
+    inline bool split_t_junctions()
+    {
+        std::vector<std::size_t> vertices;
+        vertices.reserve(2 * m_outgoing.size());
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            if (! m_edges[i].shared)
+            {
+                vertices.push_back(m_edges[i].from);
+                vertices.push_back(m_edges[i].to);
+            }
+        }
+        std::sort(vertices.begin(), vertices.end(), less_x(m_vertices));
+        vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                       vertices.end());
+
+        bool split = false;
+        std::size_t const edge_count = m_edges.size();
+        std::vector<std::pair<calculation_type, std::size_t> > on_edge;
+        for (std::size_t i = 0; i < edge_count; i++)
+        {
+            if (m_edges[i].shared)
+            {
+                continue;
+            }
+
+            std::size_t const from = m_edges[i].from;
+            std::size_t const to = m_edges[i].to;
+            Point const& p1 = m_vertices[from];
+            Point const& p2 = m_vertices[to];
+
+            coordinate_type const min_x = (std::min)(get<0>(p1), get<0>(p2));
+            coordinate_type const max_x = (std::max)(get<0>(p1), get<0>(p2));
+            coordinate_type const min_y = (std::min)(get<1>(p1), get<1>(p2));
+            coordinate_type const max_y = (std::max)(get<1>(p1), get<1>(p2));
+
+            on_edge.clear();
+            for (std::vector<std::size_t>::const_iterator it
+                    = std::lower_bound(vertices.begin(), vertices.end(),
+                                       min_x, less_x(m_vertices));
+                 it != vertices.end() && ! (max_x < get<0>(m_vertices[*it]));
+                 ++it)
+            {
+                Point const& p = m_vertices[*it];
+                if (*it == from || *it == to
+                    || get<1>(p) < min_y || max_y < get<1>(p)
+                    || strategy::side::side_by_triangle<>::apply(p1, p2, p)
+                        != 0)
+                {
+                    continue;
+                }
+
+                on_edge.push_back(std::make_pair(distance(p1, p), *it));
+            }
+
+            if (! on_edge.empty())
+            {
+                std::sort(on_edge.begin(), on_edge.end());
+                split_edge(i, on_edge);
+                split = true;
+            }
+        }
+
+        if (split)
+        {
+            for (std::size_t i = 0; i < m_edges.size(); i++)
+            {
+                m_edges[i].shared = false;
+            }
+            remove_shared_edges();
+            reset_visited();
+        }
+        return split;
+    }
+
+    // Splits the remaining edges of one component where they cross each
+    // other, such that the rings traced from them do not cross. The edges
+    // are sorted by their minimum x, and each edge is compared with the
+    // preceding edges of which the x-range is not yet passed.
+    inline void split_crossings(std::size_t component)
+    {
+        std::vector<std::size_t> sorted;
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            if (! m_edges[i].shared && m_edges[i].component == component)
+            {
+                sorted.push_back(i);
+            }
+        }
+        std::sort(sorted.begin(), sorted.end(), less_min_x(*this));
+
+        // Per edge the (comparable) distance of the crossing from its start,
+        // and the crossing vertex
+        typedef std::pair<calculation_type, std::size_t> crossing_type;
+        std::vector<std::pair<std::size_t, crossing_type> > crossings;
+
+        std::vector<std::size_t> active;
+        for (std::size_t k = 0; k < sorted.size(); k++)
+        {
+            std::size_t const e = sorted[k];
+            coordinate_type const x = min_x(e);
+            active.erase(std::remove_if(active.begin(), active.end(),
+                            max_x_smaller(*this, x)),
+                         active.end());
+
+            for (std::size_t a = 0; a < active.size(); a++)
+            {
+                Point point;
+                if (cross(active[a], e, point))
+                {
+                    std::size_t const v = vertex_id(point);
+                    crossings.push_back(std::make_pair(active[a],
+                        crossing_type(distance(from_point(active[a]), point), v)));
+                    crossings.push_back(std::make_pair(e,
+                        crossing_type(distance(from_point(e), point), v)));
+                }
+            }
+            active.push_back(e);
+        }
+
+        std::sort(crossings.begin(), crossings.end());
+        std::vector<crossing_type> on_edge;
+        for (std::size_t k = 0; k < crossings.size(); k++)
+        {
+            on_edge.push_back(crossings[k].second);
+            if (k + 1 == crossings.size()
+                || crossings[k + 1].first != crossings[k].first)
+            {
+                split_edge(crossings[k].first, on_edge);
+                on_edge.clear();
+            }
+        }
+
+        build_outgoing();
+        reset_visited();
+    }
+
+    // Returns the component of each polygon: polygons connected by shared
+    // edges have the same component
+    inline std::vector<std::size_t> const& components() const
+    {
+        return m_components;
+    }
+
+    // Traces the remaining edges of one component (or of all components)
+    // to rings, and appends them to the ring collection. A ring passing a
+    // vertex twice (for example around holes touching each other) is split
+    // there into two rings.
+    template <typename Rings>
+    inline void trace(Rings& rings, std::size_t component = none)
+    {
+        m_visited.resize(m_edges.size(), false);
+
+        std::vector<std::size_t> ids;
+        std::vector<std::size_t> position(m_vertices.size(),
+                                          std::size_t(none));
+
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            coverage_edge const& edge = m_edges[i];
+            if (edge.shared || m_visited[i]
+                || (component != none && edge.component != component))
+            {
+                continue;
+            }
+
+            ids.clear();
+            std::size_t current = i;
+            while (current != none)
+            {
+                m_visited[current] = true;
+                std::size_t const vertex = m_edges[current].from;
+                if (position[vertex] != none)
+                {
+                    // The vertex is passed before, the part after it is a
+                    // loop of its own
+                    std::size_t const first = position[vertex];
+                    append_ring(rings, ids.begin() + first, ids.end(), position);
+                    ids.resize(first);
+                }
+                position[vertex] = ids.size();
+                ids.push_back(vertex);
+                current = next_edge(current, i, component);
+            }
+
+            append_ring(rings, ids.begin(), ids.end(), position);
+        }
+    }
+
+    inline void reset_visited()
+    {
+        m_visited.assign(m_edges.size(), false);
+    }
+
+private :
+
+    // Appends the ring of the vertices to the ring collection (if it is not
+    // degenerate), and resets their positions
+    template <typename Rings>
+    inline void append_ring(Rings& rings,
+                std::vector<std::size_t>::const_iterator first,
+                std::vector<std::size_t>::const_iterator last,
+                std::vector<std::size_t>& position) const
+    {
+        typedef typename boost::range_value<Rings>::type ring_type;
+
+        ring_type ring;
+        for (std::vector<std::size_t>::const_iterator it = first;
+             it != last; ++it)
+        {
+            range::push_back(ring, m_vertices[*it]);
+            position[*it] = none;
+        }
+
+        finish_ring(ring);
+        if (boost::size(ring) > 0)
+        {
+            range::push_back(rings, ring);
+        }
+    }
+
+    // Replaces the edge by a chain of edges along the vertices, sorted by
+    // their distance from its start
+    inline void split_edge(std::size_t i,
+                std::vector<std::pair<calculation_type, std::size_t> > const& on_edge)
+    {
+        std::size_t const to = m_edges[i].to;
+        m_edges[i].to = on_edge.front().second;
+        for (std::size_t k = 1; k < on_edge.size(); k++)
+        {
+            m_edges.push_back(m_edges[i]);
+            m_edges.back().from = on_edge[k - 1].second;
+            m_edges.back().to = on_edge[k].second;
+        }
+        m_edges.push_back(m_edges[i]);
+        m_edges.back().from = on_edge.back().second;
+        m_edges.back().to = to;
+    }
+
+    // Returns true if the edges cross each other at one point, which is not
+    // a vertex of either of them, and assigns that point
+    inline bool cross(std::size_t e1, std::size_t e2, Point& point) const
+    {
+        typedef strategy::side::side_by_triangle<> side;
+
+        Point const& p1 = from_point(e1);
+        Point const& p2 = m_vertices[m_edges[e1].to];
+        Point const& q1 = from_point(e2);
+        Point const& q2 = m_vertices[m_edges[e2].to];
+
+        if (side::apply(p1, p2, q1) * side::apply(p1, p2, q2) >= 0
+            || side::apply(q1, q2, p1) * side::apply(q1, q2, p2) >= 0)
+        {
+            return false;
+        }
+
+        calculation_type const dpx = calculation_type(get<0>(p2)) - get<0>(p1);
+        calculation_type const dpy = calculation_type(get<1>(p2)) - get<1>(p1);
+        calculation_type const dqx = calculation_type(get<0>(q2)) - get<0>(q1);
+        calculation_type const dqy = calculation_type(get<1>(q2)) - get<1>(q1);
+        calculation_type const rx = calculation_type(get<0>(q1)) - get<0>(p1);
+        calculation_type const ry = calculation_type(get<1>(q1)) - get<1>(p1);
+
+        calculation_type const fraction
+            = (rx * dqy - ry * dqx) / (dpx * dqy - dpy * dqx);
+
+        set<0>(point, boost::numeric_cast<coordinate_type>(
+                            get<0>(p1) + fraction * dpx));
+        set<1>(point, boost::numeric_cast<coordinate_type>(
+                            get<1>(p1) + fraction * dpy));
+        return true;
+    }
+
+    static inline calculation_type distance(Point const& p1, Point const& p2)
+    {
+        calculation_type const dx = calculation_type(get<0>(p2)) - get<0>(p1);
+        calculation_type const dy = calculation_type(get<1>(p2)) - get<1>(p1);
+        return dx * dx + dy * dy;
+    }
+
+    inline Point const& from_point(std::size_t e) const
+    {
+        return m_vertices[m_edges[e].from];
+    }
+
+    inline coordinate_type min_x(std::size_t e) const
+    {
+        return (std::min)(get<0>(from_point(e)),
+                          get<0>(m_vertices[m_edges[e].to]));
+    }
+
+    inline coordinate_type max_x(std::size_t e) const
+    {
+        return (std::max)(get<0>(from_point(e)),
+                          get<0>(m_vertices[m_edges[e].to]));
+    }
+
+    struct less_min_x
+    {
+        inline less_min_x(coverage_edges const& edges)
+            : m_edges(edges)
+        {}
+
+        inline bool operator()(std::size_t left, std::size_t right) const
+        {
+            return m_edges.min_x(left) < m_edges.min_x(right);
+        }
+
+        coverage_edges const& m_edges;
+    };
+
+    struct max_x_smaller
+    {
+        inline max_x_smaller(coverage_edges const& edges, coordinate_type x)
+            : m_edges(edges)
+            , m_x(x)
+        {}
+
+        inline bool operator()(std::size_t e) const
+        {
+            return m_edges.max_x(e) < m_x;
+        }
+
+        coverage_edges const& m_edges;
+        coordinate_type m_x;
+    };
+
+    struct less_x
+    {
+        inline less_x(std::vector<Point> const& vertices)
+            : m_vertices(vertices)
+        {}
+
+        inline bool operator()(std::size_t left, std::size_t right) const
+        {
+            return get<0>(m_vertices[left]) < get<0>(m_vertices[right])
+                || (get<0>(m_vertices[left]) == get<0>(m_vertices[right])
+                    && left < right);
+        }
+
+        inline bool operator()(std::size_t left, coordinate_type right) const
+        {
+            return get<0>(m_vertices[left]) < right;
+        }
+
+        std::vector<Point> const& m_vertices;
+    };
+
+    template <typename Ring>
+    inline void add_ring(Ring const& ring, bool reverse, bool is_open)
+    {
+        std::size_t const n = boost::size(ring);
+        if (n < 2)
+        {
+            return;
+        }
+
+        std::size_t const first = vertex_id(range::at(ring, 0));
+        std::size_t previous = first;
+        for (std::size_t i = 1; i < n; i++)
+        {
+            std::size_t const current = vertex_id(range::at(ring, i));
+            add_edge(previous, current, reverse);
+            previous = current;
+        }
+        if (is_open)
+        {
+            add_edge(previous, first, reverse);
+        }
+    }
+
+    inline void add_edge(std::size_t from, std::size_t to, bool reverse)
+    {
+        if (from != to)
+        {
+            m_edges.push_back(reverse
+                ? coverage_edge(to, from, m_polygon_count)
+                : coverage_edge(from, to, m_polygon_count));
+        }
+    }
+
+    template <typename InputPoint>
+    inline std::size_t vertex_id(InputPoint const& input_point)
+    {
+        Point point;
+        geometry::convert(input_point, point);
+
+        std::pair<typename vertex_map::iterator, bool> const inserted
+            = m_vertex_ids.insert(std::make_pair(
+                vertex_key(geometry::get<0>(point), geometry::get<1>(point)),
+                m_vertices.size()));
+        if (inserted.second)
+        {
+            m_vertices.push_back(point);
+        }
+        return inserted.first->second;
+    }
+
+    static inline std::size_t find(std::vector<std::size_t>& parent,
+                std::size_t i)
+    {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    }
+
+    static inline void unite(std::vector<std::size_t>& parent,
+                std::size_t i, std::size_t j)
+    {
+        i = find(parent, i);
+        j = find(parent, j);
+        if (i != j)
+        {
+            // The smallest index becomes the representative
+            parent[(std::max)(i, j)] = (std::min)(i, j);
+        }
+    }
+
+    // Stores the remaining edges per vertex they start from
+    inline void build_outgoing()
+    {
+        m_outgoing_offsets.assign(m_vertices.size() + 1, 0);
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            if (! m_edges[i].shared)
+            {
+                m_outgoing_offsets[m_edges[i].from + 1]++;
+            }
+        }
+        for (std::size_t v = 0; v < m_vertices.size(); v++)
+        {
+            m_outgoing_offsets[v + 1] += m_outgoing_offsets[v];
+        }
+
+        m_outgoing.resize(m_outgoing_offsets.back());
+        std::vector<std::size_t> position(m_outgoing_offsets.begin(),
+                                          m_outgoing_offsets.end() - 1);
+        for (std::size_t i = 0; i < m_edges.size(); i++)
+        {
+            if (! m_edges[i].shared)
+            {
+                m_outgoing[position[m_edges[i].from]++] = i;
+            }
+        }
+    }
+
+    // Returns the edge following the incoming edge in the ring starting
+    // with the start edge, or none if the ring is closed. If more edges
+    // leave the vertex (where rings touch), the edge making the sharpest
+    // right turn is taken, keeping the interior at the right side, such
+    // that touching rings are traced separately.
+    inline std::size_t next_edge(std::size_t incoming, std::size_t start,
+                std::size_t component) const
+    {
+        std::size_t const vertex = m_edges[incoming].to;
+        bool const at_start = vertex == m_edges[start].from;
+
+        std::size_t result = none;
+        calculation_type best_angle = 0;
+        std::size_t candidate_count = 0;
+
+        for (std::size_t k = m_outgoing_offsets[vertex];
+             k < m_outgoing_offsets[vertex + 1]; k++)
+        {
+            std::size_t const e = m_outgoing[k];
+            if ((m_visited[e] && ! (at_start && e == start))
+                || (component != none && m_edges[e].component != component))
+            {
+                continue;
+            }
+
+            candidate_count++;
+            if (candidate_count == 1)
+            {
+                result = e;
+                continue;
+            }
+
+            if (candidate_count == 2)
+            {
+                best_angle = turn_angle(incoming, result);
+            }
+            calculation_type const angle = turn_angle(incoming, e);
+            if (angle < best_angle)
+            {
+                best_angle = angle;
+                result = e;
+            }
+        }
+
+        return result == start ? std::size_t(none) : result;
+    }
+
+    // Returns the counter clockwise angle from the reversed incoming edge
+    // to the outgoing edge, in (0, 2 pi]. The smallest angle is the
+    // sharpest right turn.
+    inline calculation_type turn_angle(std::size_t incoming,
+                std::size_t outgoing) const
+    {
+        Point const& p0 = m_vertices[m_edges[incoming].from];
+        Point const& p1 = m_vertices[m_edges[incoming].to];
+        Point const& p2 = m_vertices[m_edges[outgoing].to];
+
+        calculation_type const rx = calculation_type(get<0>(p0)) - get<0>(p1);
+        calculation_type const ry = calculation_type(get<1>(p0)) - get<1>(p1);
+        calculation_type const ox = calculation_type(get<0>(p2)) - get<0>(p1);
+        calculation_type const oy = calculation_type(get<1>(p2)) - get<1>(p1);
+
+        calculation_type angle = std::atan2(rx * oy - ry * ox,
+                                            rx * ox + ry * oy);
+        if (angle <= 0)
+        {
+            angle += geometry::math::two_pi<calculation_type>();
+        }
+        return angle;
+    }
+
+    template <typename Ring>
+    static inline void finish_ring(Ring& ring)
+    {
+        if (boost::size(ring) < 3)
+        {
+            // A spike, or a degenerate ring
+            range::clear(ring);
+            return;
+        }
+
+        if (geometry::closure<Ring>::value == closed)
+        {
+            range::push_back(ring, range::front(ring));
+        }
+        if (geometry::point_order<Ring>::value == counterclockwise)
+        {
+            std::reverse(boost::begin(ring), boost::end(ring));
+        }
+    }
+
+    typedef boost::unordered_map
+        <
+            vertex_key, std::size_t, boost::hash<vertex_key>
+        > vertex_map;
+
+    std::size_t m_polygon_count;
+    vertex_map m_vertex_ids;
+    std::vector<Point> m_vertices;
+    std::vector<coverage_edge> m_edges;
+    std::vector<std::size_t> m_components;
+    std::vector<bool> m_overlapping;
+    std::vector<std::size_t> m_outgoing_offsets;
+    std::vector<std::size_t> m_outgoing;
+    std::vector<bool> m_visited;
+};
+
+
+// Assigns the holes of the traced rings to their outer rings, and adds
+// the resulting polygons to the multi-polygon
+template <typename Rings, typename MultiPolygon>
+inline void add_traced_rings(Rings const& rings, MultiPolygon& result)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef detail::overlay::ring_properties
+        <
+            typename geometry::point_type<polygon_type>::type
+        > properties;
+
+    detail::overlay::ring_identifier_map<properties> selected;
+    selected.reserve(boost::size(rings));
+
+    ring_identifier id(2, 0, -1);
+    for (typename boost::range_iterator<Rings const>::type
+            it = boost::begin(rings);
+         it != boost::end(rings);
+         ++it, ++id.multi_index)
+    {
+        selected[id] = properties(*it);
+    }
+
+    polygon_type empty;
+    detail::overlay::assign_parents(empty, rings, selected, false);
+    detail::overlay::add_rings<polygon_type>(selected, empty, rings,
+                std::back_inserter(result));
+}
+
+
+// A ring, or a polygon, with its envelope and a point in its interior,
+// to find rings containing each other
+template <typename Point, typename Area>
+struct ring_item
+{
+    typedef model::box<Point> box_type;
+
+    template <typename Ring>
+    inline ring_item(Ring const& ring, Area const& a, std::size_t i)
+        : area(a)
+        , index(i)
+    {
+        geometry::envelope(ring, box);
+        geometry::point_on_surface(ring, point);
+    }
+
+    box_type box;
+    Point point;
+    Area area;
+    std::size_t index;
+};
+
+struct expand_ring_item
+{
+    template <typename Box, typename Item>
+    static inline void apply(Box& total, Item const& item)
+    {
+        geometry::expand(total, item.box);
+    }
+};
+
+struct overlaps_ring_item
+{
+    template <typename Box, typename Item>
+    static inline bool apply(Box const& box, Item const& item)
+    {
+        return ! geometry::disjoint(box, item.box);
+    }
+};
+
+// Adds, per ring, the signs of the rings containing it (see below)
+template <typename Rings>
+class winding_visitor
+{
+public :
+    inline winding_visitor(Rings const& regions, std::vector<int> const& signs,
+                std::vector<int>& windings)
+        : m_regions(regions)
+        , m_signs(signs)
+        , m_windings(windings)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        // Only the larger ring (or of equal rings the first) can contain
+        // the other
+        bool const first_is_outer = item2.area < item1.area
+            || (! (item1.area < item2.area) && item1.index < item2.index);
+        Item const& outer = first_is_outer ? item1 : item2;
+        Item const& inner = first_is_outer ? item2 : item1;
+
+        if (geometry::covered_by(inner.box, outer.box)
+            && geometry::within(inner.point, range::at(m_regions, outer.index)))
+        {
+            m_windings[inner.index] += m_signs[outer.index];
+        }
+        return true;
+    }
+
+private :
+    Rings const& m_regions;
+    std::vector<int> const& m_signs;
+    std::vector<int>& m_windings;
+};
+
+// Keeps, of rings traced from edges which do not cross, the rings on the
+// boundary of the union. The winding number outside a ring is the sum of
+// the signs of the rings containing it (clockwise rings count 1, counter
+// clockwise rings -1). Clockwise rings with 0 outside, and counter
+// clockwise rings with 1 outside, are kept. Rings which do not cross are
+// nested or disjoint, so a ring is contained by a larger ring if that ring
+// contains a point in its interior. Of equal rings, the first one contains
+// the others.
+template <typename Rings>
+inline void select_boundary_rings(Rings& rings)
+{
+    typedef typename boost::range_value<Rings>::type ring_type;
+    typedef typename geometry::point_type<ring_type>::type point_type;
+    typedef typename default_area_result<ring_type>::type area_type;
+    typedef ring_item<point_type, area_type> item_type;
+
+    std::size_t const count = boost::size(rings);
+
+    // All rings are stored clockwise, for the containment tests
+    Rings regions(rings);
+    std::vector<int> signs(count, 0);
+    std::vector<item_type> items;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        ring_type& region = range::at(regions, i);
+        area_type const area = geometry::area(region);
+        if (math::equals(area, area_type()))
+        {
+            continue;
+        }
+
+        signs[i] = area > 0 ? 1 : -1;
+        if (signs[i] < 0)
+        {
+            std::reverse(boost::begin(region), boost::end(region));
+        }
+        items.push_back(item_type(region, geometry::math::abs(area), i));
+    }
+
+    std::vector<int> windings(count, 0);
+    winding_visitor<Rings> visitor(regions, signs, windings);
+    geometry::partition
+        <
+            typename item_type::box_type,
+            expand_ring_item,
+            overlaps_ring_item
+        >::apply(items, visitor);
+
+    Rings selected;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if ((signs[i] > 0 && windings[i] == 0)
+            || (signs[i] < 0 && windings[i] == 1))
+        {
+            range::push_back(selected, range::at(rings, i));
+        }
+    }
+
+    rings.swap(selected);
+}
+
+
+// Sets nested to true if a polygon lies within another polygon.
+// (is_valid does not compare polygons having turns with other polygons)
+template <typename MultiPolygon>
+class nested_visitor
+{
+public :
+    inline nested_visitor(MultiPolygon const& multi_polygon)
+        : nested(false)
+        , m_multi_polygon(multi_polygon)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        if (geometry::within(item1.point,
+                             range::at(m_multi_polygon, item2.index))
+            || geometry::within(item2.point,
+                             range::at(m_multi_polygon, item1.index)))
+        {
+            nested = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool nested;
+
+private :
+    MultiPolygon const& m_multi_polygon;
+};
+
+// Returns true if the multi-polygon is valid, and its polygons do not lie
+// within each other
+template <typename MultiPolygon>
+inline bool is_valid_union(MultiPolygon const& multi_polygon)
+{
+    typedef typename geometry::point_type<MultiPolygon>::type point_type;
+    typedef ring_item<point_type, int> item_type;
+
+    if (! geometry::is_valid(multi_polygon))
+    {
+        return false;
+    }
+
+    std::vector<item_type> items;
+    items.reserve(boost::size(multi_polygon));
+    for (std::size_t i = 0; i < boost::size(multi_polygon); i++)
+    {
+        items.push_back(item_type(
+            geometry::exterior_ring(range::at(multi_polygon, i)), 0, i));
+    }
+
+    nested_visitor<MultiPolygon> visitor(multi_polygon);
+    geometry::partition
+        <
+            typename item_type::box_type,
+            expand_ring_item,
+            overlaps_ring_item
+        >::apply(items, visitor);
+    return ! visitor.nested;
+}
+
+
+template <typename Geometries, typename MultiPolygon>
+inline void apply(Geometries const& geometries, MultiPolygon& result)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename geometry::ring_type<polygon_type>::type ring_type;
+
+    coverage_edges<typename geometry::point_type<polygon_type>::type> edges;
+    for (typename boost::range_iterator<Geometries const>::type
+            it = boost::begin(geometries);
+         it != boost::end(geometries);
+         ++it)
+    {
+        polygons<geometry_type>::apply(*it, edges);
+    }
+
+    edges.remove_shared_edges();
+
+    // Edges which are not split at the same vertices are shared after
+    // splitting them. Only remaining edges are involved, normally the
+    // edges on the boundary of the union.
+    edges.split_t_junctions();
+
+    if (! edges.overlapping())
+    {
+        std::vector<ring_type> rings;
+        edges.trace(rings);
+        add_traced_rings(rings, result);
+        if (is_valid_union(result))
+        {
+            // If the remaining edges form a valid multi-polygon, they cover
+            // each location at most once, so the input polygons do not
+            // overlap, and the multi-polygon is their union
+            return;
+        }
+    }
+
+    // Polygons overlap. Each component (polygons connected by shared edges)
+    // is traced separately. The remaining edges of overlapping components
+    // are split where they cross, and traced again, and only the rings on
+    // the boundary of their union are kept. Then the components are unioned
+    // by the general overlay. Shared edges are not passed to the overlay.
+    result.clear();
+    edges.reset_visited();
+
+    std::vector<std::size_t> const& components = edges.components();
+    std::size_t const polygon_count = edges.polygon_count();
+
+    std::vector<MultiPolygon> parts;
+    std::vector<std::size_t> part_of_component(polygon_count,
+                static_cast<std::size_t>(-1));
+    for (std::size_t i = 0; i < polygon_count; i++)
+    {
+        std::size_t const component = components[i];
+        if (part_of_component[component] != static_cast<std::size_t>(-1))
+        {
+            continue;
+        }
+
+        part_of_component[component] = parts.size();
+        parts.push_back(MultiPolygon());
+
+        std::vector<ring_type> rings;
+        edges.trace(rings, component);
+        add_traced_rings(rings, parts.back());
+        if (! edges.overlapping(component)
+            && is_valid_union(parts.back()))
+        {
+            continue;
+        }
+
+        parts.back().clear();
+        edges.split_crossings(component);
+
+        rings.clear();
+        edges.trace(rings, component);
+        select_boundary_rings(rings);
+        add_traced_rings(rings, parts.back());
+    }
+
+    if (parts.size() == 1)
+    {
+        result.swap(parts.front());
+        return;
+    }
+
+    detail::cascaded_union::apply(parts, result, 1);
+}
+
+
+}} // namespace detail::coverage_union
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Unions a coverage: a collection of polygons sharing exact edges
+\ingroup overlay
+\details In a coverage (for example administrative areas), neighbouring
+    polygons have the same vertices along their common boundary. These
+    shared edges occur twice, in opposite directions, and are found by
+    hashing their exact coordinates, and removed. The remaining edges are
+    traced to the rings of the result, in (expected) linear time, without
+    calculating turns or clusters. Remaining edges are split where a vertex
+    of one polygon lies on an edge of another (T-junctions), such that
+    polygons which are not split at the same vertices share edges as well.
+    Where polygons overlap, the remaining edges of the affected components
+    (polygons connected by shared edges) are split where they cross, and
+    the rings traced from them are selected by their winding number. Only
+    the resulting components are unioned by the general overlay, shared
+    edges are never passed to it.
+    The coordinate system should be 2D cartesian.
+\tparam Geometries range of polygons or multi-polygons
+\tparam Collection output collection of polygons, for example a multi-polygon
+\param geometries the geometries to union
+\param output_collection the output collection, the result is appended
+*/
+template <typename Geometries, typename Collection>
+inline void coverage_union(Geometries const& geometries,
+            Collection& output_collection)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_value<Collection>::type polygon_type;
+
+    concepts::check<geometry_type const>();
+    concepts::check<polygon_type>();
+
+    typedef model::multi_polygon<polygon_type> multi_polygon_type;
+
+    multi_polygon_type result;
+    detail::coverage_union::apply(geometries, result);
+
+    for (typename boost::range_iterator<multi_polygon_type const>::type
+            it = boost::begin(result);
+         it != boost::end(result);
+         ++it)
+    {
+        range::push_back(output_collection, *it);
+    }
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COVERAGE_UNION_HPP
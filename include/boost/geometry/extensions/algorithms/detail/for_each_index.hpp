@@ -0,0 +1,138 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_FOR_EACH_INDEX_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_FOR_EACH_INDEX_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#if ! defined(BOOST_NO_CXX11_HDR_THREAD)
+#  include <exception>
+#  include <thread>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+
+#if ! defined(BOOST_NO_CXX11_HDR_THREAD)
+
+template <typename Task>
+struct interleaved_task
+{
+    inline interleaved_task(Task const& task,
+                std::size_t first, std::size_t step, std::size_t count,
+                std::exception_ptr& error)
+        : m_task(task)
+        , m_first(first)
+        , m_step(step)
+        , m_count(count)
+        , m_error(error)
+    {}
+
+    inline void operator()() const
+    {
+        try
+        {
+            for (std::size_t i = m_first; i < m_count; i += m_step)
+            {
+                m_task.apply(i);
+            }
+        }
+        catch (...)
+        {
+            m_error = std::current_exception();
+        }
+    }
+
+    Task const& m_task;
+    std::size_t m_first;
+    std::size_t m_step;
+    std::size_t m_count;
+    std::exception_ptr& m_error;
+};
+
+#endif
+
+
+// Calls task.apply(i) for all i in [0, count). The indices are interleaved
+// over the threads, such that expensive neighbouring items (for example
+// the large polygons of a country) are distributed over all threads
+template <typename Task>
+inline void for_each_index(Task const& task, std::size_t count,
+            std::size_t thread_count)
+{
+    if (thread_count > count)
+    {
+        thread_count = count;
+    }
+
+#if ! defined(BOOST_NO_CXX11_HDR_THREAD)
+    if (thread_count > 1)
+    {
+        std::vector<std::exception_ptr> errors(thread_count);
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        try
+        {
+            for (std::size_t i = 0; i < thread_count; i++)
+            {
+                threads.push_back(std::thread(interleaved_task<Task>(task,
+                        i, thread_count, count, errors[i])));
+            }
+        }
+        catch (...)
+        {
+            // A thread could not be started. The started threads must be
+            // joined before they are destructed
+            for (std::size_t i = 0; i < threads.size(); i++)
+            {
+                threads[i].join();
+            }
+            throw;
+        }
+        for (std::size_t i = 0; i < thread_count; i++)
+        {
+            threads[i].join();
+        }
+        for (std::size_t i = 0; i < thread_count; i++)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        task.apply(i);
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DETAIL_FOR_EACH_INDEX_HPP
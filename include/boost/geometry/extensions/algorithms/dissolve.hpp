@@ -29,6 +29,7 @@
 
 #include <boost/geometry/algorithms/detail/overlay/add_rings.hpp>
 #include <boost/geometry/algorithms/detail/overlay/assign_parents.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
 #include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
 #include <boost/geometry/algorithms/detail/overlay/select_rings.hpp>
 
@@ -213,12 +214,12 @@ struct dissolve_ring_or_polygon
                 >::apply(geometry, geometry, rescale_policy,
                             turns, rings, clusters, visitor);
 
-            std::map<ring_identifier, detail::overlay::ring_turn_info> map;
+            detail::overlay::ring_identifier_map<detail::overlay::ring_turn_info> map;
             get_ring_turn_info(map, turns);
 
             typedef detail::overlay::ring_properties<typename geometry::point_type<Geometry>::type> properties;
 
-            std::map<ring_identifier, properties> selected;
+            detail::overlay::ring_identifier_map<properties> selected;
 
             detail::overlay::select_rings<overlay_dissolve>(geometry, map, selected);
 
@@ -0,0 +1,400 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INCREMENTAL_BUFFER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INCREMENTAL_BUFFER_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Buffer of a linestring growing at its end, such as a track of a
+    vehicle, updated incrementally
+\ingroup buffer
+\details Points are appended one by one. The linestring is split into a
+    settled part and a tail. When the tail has more than the specified
+    number of points, its first part is settled: it is buffered and merged
+    into the buffer of the settled part, and is not buffered again. The
+    current buffer is the union of the settled buffer and the buffer of the
+    tail, which is calculated on demand.
+    The union of the buffers of two consecutive parts, and of the buffer of
+    the three points around the vertex where they meet (which has the join
+    there), is the buffer of the whole linestring. With round ends, the
+    approximated ends at the shared point can stick out a little beyond the
+    approximated join there.
+    Settled parts are first merged into a small pending buffer, which is
+    merged into the settled buffer after every 4 parts, and unioned with
+    the buffer of the tail before that is merged. The envelopes of the
+    rings of the settled buffer are kept. Only its polygons and holes whose envelopes
+    intersect the envelope of the geometry to merge are unioned with it by
+    the overlay. The other holes are added to the resulting polygon
+    afterwards, and the other polygons are copied. The buffer of a track is
+    usually one polygon, whose exterior ring is always unioned, so the cost
+    of calculating the current buffer still grows with the size of that
+    ring.
+\tparam Linestring \tparam_geometry{Linestring}
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+ */
+template
+<
+    typename Linestring,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+class incremental_buffer
+{
+public :
+    typedef typename point_type<Linestring>::type point_type;
+
+private :
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename ring_type<polygon_type>::type ring_type;
+    typedef model::box<point_type> box_type;
+
+    // Per polygon the envelopes of its exterior ring and interior rings
+    typedef std::vector<box_type> ring_envelopes;
+
+public :
+
+    /*!
+    \brief Constructs the incremental buffer, without points
+    \param distance_strategy The distance strategy to be used
+    \param side_strategy The side strategy to be used
+    \param join_strategy The join strategy to be used
+    \param end_strategy The end strategy to be used
+    \param point_strategy The point strategy to be used
+    \param tail_size number of points of the tail, above which its first
+        part is settled
+    */
+    inline incremental_buffer(DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t tail_size = 64)
+        : m_distance_strategy(distance_strategy)
+        , m_side_strategy(side_strategy)
+        , m_join_strategy(join_strategy)
+        , m_end_strategy(end_strategy)
+        , m_point_strategy(point_strategy)
+        , m_tail_size(tail_size < 3 ? 3 : tail_size)
+        , m_count(0)
+        , m_pending_count(0)
+    {
+        concepts::check<Linestring>();
+        concepts::check<typename boost::range_value<MultiPolygon>::type>();
+    }
+
+    //! Appends a point to the end of the linestring. A point equal to the
+    //! last point is skipped.
+    inline void append(point_type const& point)
+    {
+        if (! boost::empty(m_tail)
+            && detail::equals::equals_point_point(range::back(m_tail), point))
+        {
+            return;
+        }
+
+        range::push_back(m_tail, point);
+        m_count++;
+
+        if (boost::size(m_tail) > m_tail_size)
+        {
+            settle();
+        }
+    }
+
+    //! Removes all points
+    inline void clear()
+    {
+        geometry::clear(m_tail);
+        geometry::clear(m_pending);
+        geometry::clear(m_settled);
+        m_envelopes.clear();
+        m_pending_count = 0;
+        m_count = 0;
+    }
+
+    //! Returns the number of (distinct) points appended
+    inline std::size_t size() const
+    {
+        return m_count;
+    }
+
+    //! Calculates the current buffer of the linestring
+    inline void get(MultiPolygon& geometry_out) const
+    {
+        geometry::clear(geometry_out);
+        if (boost::empty(m_tail))
+        {
+            return;
+        }
+
+        MultiPolygon tail_buffer;
+        buffer(m_tail, tail_buffer);
+        if (! boost::empty(m_pending))
+        {
+            MultiPolygon unioned;
+            geometry::union_(m_pending, tail_buffer, unioned);
+            tail_buffer.swap(unioned);
+        }
+
+        if (boost::empty(m_settled))
+        {
+            geometry_out.swap(tail_buffer);
+            return;
+        }
+
+        std::vector<ring_envelopes> envelopes;
+        merge(tail_buffer, geometry_out, envelopes);
+    }
+
+private :
+
+    template <typename Geometry>
+    inline void buffer(Geometry const& geometry, MultiPolygon& result) const
+    {
+        geometry::buffer(geometry, result,
+                m_distance_strategy, m_side_strategy, m_join_strategy,
+                m_end_strategy, m_point_strategy);
+    }
+
+    static inline void add_envelopes(polygon_type const& polygon,
+                std::vector<ring_envelopes>& envelopes)
+    {
+        envelopes.push_back(ring_envelopes());
+        ring_envelopes& boxes = envelopes.back();
+        boxes.push_back(geometry::return_envelope<box_type>(
+                            geometry::exterior_ring(polygon)));
+        for (typename boost::range_iterator
+                <
+                    typename interior_type<polygon_type>::type const
+                >::type it = boost::begin(geometry::interior_rings(polygon));
+             it != boost::end(geometry::interior_rings(polygon));
+             ++it)
+        {
+            boxes.push_back(geometry::return_envelope<box_type>(*it));
+        }
+    }
+
+    // Unions the geometry with the settled buffer, and assigns the
+    // envelopes of the result. Polygons of the settled buffer whose
+    // envelope is disjoint from the geometry are copied. Holes whose
+    // envelope is disjoint from the geometry are left out of the overlay,
+    // and added afterwards to the resulting polygon containing them (which
+    // contains the polygon they belonged to: such a hole is not touched by
+    // the geometry, nor by the other polygons passed to the overlay).
+    inline void merge(MultiPolygon const& geometry, MultiPolygon& result,
+                std::vector<ring_envelopes>& envelopes) const
+    {
+        box_type const box = geometry::return_envelope<box_type>(geometry);
+
+        // The polygons to union, with their holes intersecting the geometry,
+        // and per polygon its index and the holes left out
+        MultiPolygon input;
+        std::vector<std::size_t> origin;
+        std::vector<std::vector<std::size_t> > left_out;
+
+        for (std::size_t i = 0; i < boost::size(m_settled); i++)
+        {
+            polygon_type const& polygon = range::at(m_settled, i);
+            ring_envelopes const& boxes = m_envelopes[i];
+            if (geometry::disjoint(boxes.front(), box))
+            {
+                range::push_back(result, polygon);
+                envelopes.push_back(boxes);
+                continue;
+            }
+
+            range::resize(input, boost::size(input) + 1);
+            polygon_type& copy = range::back(input);
+            geometry::exterior_ring(copy) = geometry::exterior_ring(polygon);
+            origin.push_back(i);
+            left_out.push_back(std::vector<std::size_t>());
+            for (std::size_t j = 1; j < boxes.size(); j++)
+            {
+                if (geometry::disjoint(boxes[j], box))
+                {
+                    left_out.back().push_back(j - 1);
+                }
+                else
+                {
+                    range::push_back(geometry::interior_rings(copy),
+                        range::at(geometry::interior_rings(polygon), j - 1));
+                }
+            }
+        }
+
+        MultiPolygon unioned;
+        geometry::union_(input, geometry, unioned);
+
+        std::size_t const first = boost::size(result);
+        for (std::size_t i = 0; i < boost::size(unioned); i++)
+        {
+            range::push_back(result, range::at(unioned, i));
+            add_envelopes(range::back(result), envelopes);
+        }
+
+        for (std::size_t k = 0; k < left_out.size(); k++)
+        {
+            if (left_out[k].empty())
+            {
+                continue;
+            }
+
+            polygon_type const& polygon = range::at(m_settled, origin[k]);
+            ring_envelopes const& boxes = m_envelopes[origin[k]];
+
+            // Find the resulting polygon containing a hole left out
+            std::size_t target = first;
+            if (boost::size(unioned) > 1)
+            {
+                point_type const& point = range::front(range::at(
+                    geometry::interior_rings(polygon), left_out[k].front()));
+                for (std::size_t i = first; i < boost::size(result); i++)
+                {
+                    if (geometry::covered_by(point, envelopes[i].front())
+                        && geometry::within(point, range::at(result, i)))
+                    {
+                        target = i;
+                        break;
+                    }
+                }
+            }
+
+            polygon_type& target_polygon = range::at(result, target);
+            for (std::size_t j = 0; j < left_out[k].size(); j++)
+            {
+                std::size_t const hole = left_out[k][j];
+                range::push_back(geometry::interior_rings(target_polygon),
+                    range::at(geometry::interior_rings(polygon), hole));
+                envelopes[target].push_back(boxes[hole + 1]);
+            }
+        }
+    }
+
+    // Settles all points of the tail but the last two. The new tail starts
+    // at the last settled point, such that the parts share that point.
+    inline void settle()
+    {
+        std::size_t const split = boost::size(m_tail) - 2;
+
+        Linestring part;
+        for (std::size_t i = 0; i <= split; i++)
+        {
+            range::push_back(part, range::at(m_tail, i));
+        }
+
+        // The parts have ends at the shared point, the join there is
+        // added separately
+        Linestring join;
+        range::push_back(join, range::at(m_tail, split - 1));
+        range::push_back(join, range::at(m_tail, split));
+        range::push_back(join, range::at(m_tail, split + 1));
+
+        MultiPolygon part_buffer, join_buffer, merged;
+        buffer(part, part_buffer);
+        buffer(join, join_buffer);
+        geometry::union_(part_buffer, join_buffer, merged);
+
+        if (boost::empty(m_pending))
+        {
+            m_pending.swap(merged);
+        }
+        else
+        {
+            MultiPolygon pending;
+            geometry::union_(m_pending, merged, pending);
+            m_pending.swap(pending);
+        }
+
+        if (++m_pending_count >= 4)
+        {
+            flush();
+        }
+
+        Linestring tail;
+        range::push_back(tail, range::at(m_tail, split));
+        range::push_back(tail, range::at(m_tail, split + 1));
+        m_tail.swap(tail);
+    }
+
+    // Merges the pending buffer into the settled buffer
+    inline void flush()
+    {
+        MultiPolygon settled;
+        std::vector<ring_envelopes> envelopes;
+        if (boost::empty(m_settled))
+        {
+            settled.swap(m_pending);
+            for (std::size_t i = 0; i < boost::size(settled); i++)
+            {
+                add_envelopes(range::at(settled, i), envelopes);
+            }
+        }
+        else
+        {
+            merge(m_pending, settled, envelopes);
+        }
+        m_settled.swap(settled);
+        m_envelopes.swap(envelopes);
+
+        geometry::clear(m_pending);
+        m_pending_count = 0;
+    }
+
+    DistanceStrategy m_distance_strategy;
+    SideStrategy m_side_strategy;
+    JoinStrategy m_join_strategy;
+    EndStrategy m_end_strategy;
+    PointStrategy m_point_strategy;
+    std::size_t m_tail_size;
+    std::size_t m_count;
+    std::size_t m_pending_count;
+
+    Linestring m_tail;
+    MultiPolygon m_pending;
+    MultiPolygon m_settled;
+    std::vector<ring_envelopes> m_envelopes;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_INCREMENTAL_BUFFER_HPP
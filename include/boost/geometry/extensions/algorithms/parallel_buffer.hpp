@@ -0,0 +1,389 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_BUFFER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_BUFFER_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/multi_linestring.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/algorithms/buffer.hpp>
+
+#include <boost/geometry/extensions/algorithms/cascaded_union.hpp>
+#include <boost/geometry/extensions/algorithms/detail/for_each_index.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel_buffer
+{
+
+
+// The multi-geometry collecting a group of geometries, which is buffered
+// at once. Multi-geometries are collected in their own type.
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct group_type
+{
+    typedef Geometry type;
+};
+
+template <typename Point>
+struct group_type<Point, point_tag>
+{
+    typedef model::multi_point<Point> type;
+};
+
+template <typename Linestring>
+struct group_type<Linestring, linestring_tag>
+{
+    typedef model::multi_linestring<Linestring> type;
+};
+
+template <typename Polygon>
+struct group_type<Polygon, polygon_tag>
+{
+    typedef model::multi_polygon<Polygon> type;
+};
+
+
+// Adds a geometry to a group: a single geometry is added as a component,
+// the components of a multi-geometry are added one by one
+struct add_components
+{
+    template <typename Geometry, typename Group>
+    static inline void apply(Geometry const& geometry, Group& group)
+    {
+        for (typename boost::range_iterator<Geometry const>::type
+                it = boost::begin(geometry);
+             it != boost::end(geometry);
+             ++it)
+        {
+            range::push_back(group, *it);
+        }
+    }
+};
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct add_to_group
+{
+    template <typename Group>
+    static inline void apply(Geometry const& geometry, Group& group)
+    {
+        range::push_back(group, geometry);
+    }
+};
+
+template <typename Geometry>
+struct add_to_group<Geometry, multi_point_tag> : add_components
+{};
+
+template <typename Geometry>
+struct add_to_group<Geometry, multi_linestring_tag> : add_components
+{};
+
+template <typename Geometry>
+struct add_to_group<Geometry, multi_polygon_tag> : add_components
+{};
+
+
+// Buffers one group of spatially clustered geometries
+template
+<
+    typename Geometries,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+struct group_task
+{
+    typedef typename group_type
+        <
+            typename boost::range_value<Geometries>::type
+        >::type group_type;
+
+    inline group_task(Geometries const& geometries,
+                std::vector<std::size_t> const& indices,
+                std::vector<std::size_t> const& offsets,
+                std::vector<MultiPolygon>& results,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy)
+        : m_geometries(geometries)
+        , m_indices(indices)
+        , m_offsets(offsets)
+        , m_results(results)
+        , m_distance_strategy(distance_strategy)
+        , m_side_strategy(side_strategy)
+        , m_join_strategy(join_strategy)
+        , m_end_strategy(end_strategy)
+        , m_point_strategy(point_strategy)
+    {}
+
+    inline void apply(std::size_t group_index) const
+    {
+        group_type group;
+        for (std::size_t i = m_offsets[group_index];
+             i < m_offsets[group_index + 1]; i++)
+        {
+            add_to_group
+                <
+                    typename boost::range_value<Geometries>::type
+                >::apply(range::at(m_geometries, m_indices[i]), group);
+        }
+
+        geometry::buffer(group, m_results[group_index],
+                m_distance_strategy, m_side_strategy, m_join_strategy,
+                m_end_strategy, m_point_strategy);
+    }
+
+    Geometries const& m_geometries;
+    std::vector<std::size_t> const& m_indices;
+    std::vector<std::size_t> const& m_offsets;
+    std::vector<MultiPolygon>& m_results;
+    DistanceStrategy const& m_distance_strategy;
+    SideStrategy const& m_side_strategy;
+    JoinStrategy const& m_join_strategy;
+    EndStrategy const& m_end_strategy;
+    PointStrategy const& m_point_strategy;
+};
+
+
+// Buffers the geometries of a range, in spatially clustered groups, in
+// parallel, and unions the buffers of the groups in cascade
+template
+<
+    typename Geometries,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void apply(Geometries const& geometries,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count)
+{
+    std::size_t const count = boost::size(geometries);
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Using more groups than threads balances the load, because the
+    // buffers of the groups differ in complexity
+    std::size_t const groups_per_thread = 4;
+    std::size_t group_count
+        = thread_count == 1 ? 1 : thread_count * groups_per_thread;
+    if (group_count > count)
+    {
+        group_count = count;
+    }
+
+    // Neighbouring geometries are buffered in the same group, such that
+    // most of the interaction between their buffers is handled there
+    std::vector<std::size_t> indices;
+    if (group_count > 1)
+    {
+        cascaded_union::spatial_order(geometries, indices);
+    }
+    else
+    {
+        indices.resize(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            indices[i] = i;
+        }
+    }
+
+    std::vector<std::size_t> offsets(group_count + 1);
+    for (std::size_t i = 0; i <= group_count; i++)
+    {
+        offsets[i] = i * count / group_count;
+    }
+
+    std::vector<MultiPolygon> results(group_count);
+    parallel::for_each_index(
+        group_task
+            <
+                Geometries, MultiPolygon,
+                DistanceStrategy, SideStrategy, JoinStrategy,
+                EndStrategy, PointStrategy
+            >(geometries, indices, offsets, results,
+              distance_strategy, side_strategy, join_strategy,
+              end_strategy, point_strategy),
+        group_count, thread_count);
+
+    if (group_count == 1)
+    {
+        geometry_out.swap(results.front());
+        return;
+    }
+
+    cascaded_union::apply(results, geometry_out, thread_count);
+}
+
+
+}} // namespace detail::parallel_buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_calc{buffer}, using multiple threads
+\ingroup buffer
+\details The components of the multi-geometry are divided into groups of
+    spatially clustered components, which are buffered independently by
+    multiple threads. The buffers of the groups are combined by a cascaded
+    union, also using multiple threads. The result is the same as the
+    result of the buffer with one thread (apart from the precision).
+    If the compiler does not support C++11 threads, the buffer is
+    calculated sequentially.
+\tparam MultiGeometry a multi-point, multi-linestring or multi-polygon
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param geometry_in the geometry to buffer
+\param geometry_out output multi polygon, will contain a buffered version
+    of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param thread_count maximum number of threads to use
+ */
+template
+<
+    typename MultiGeometry,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer(MultiGeometry const& geometry_in,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename tag<MultiGeometry>::type tag_type;
+    concepts::check<MultiGeometry const>();
+    concepts::check<polygon_type>();
+
+    // The components of the input are buffered, a single geometry would
+    // be iterated as if its points were components
+    BOOST_MPL_ASSERT_MSG
+        (
+            (boost::mpl::or_
+                <
+                    boost::is_same<tag_type, multi_point_tag>,
+                    boost::is_same<tag_type, multi_linestring_tag>,
+                    boost::is_same<tag_type, multi_polygon_tag>
+                >::value),
+            NOT_IMPLEMENTED_FOR_NON_MULTI_GEOMETRIES,
+            (types<MultiGeometry>)
+        );
+
+    geometry_out.clear();
+    detail::parallel_buffer::apply(geometry_in, geometry_out,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy,
+            thread_count == 0 ? 1 : thread_count);
+}
+
+
+/*!
+\brief Buffers all geometries of a range, and unions their buffers,
+    using multiple threads
+\ingroup buffer
+\details For example a large collection of features (road segments) is
+    buffered into one multi-polygon. The geometries are divided into groups
+    of spatially clustered geometries, which are buffered independently by
+    multiple threads, and the buffers of the groups are combined by a
+    cascaded union.
+\tparam Geometries range of geometries (points, linestrings, polygons or
+    their multi-geometries)
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param geometries the geometries to buffer
+\param geometry_out output multi polygon, will contain the union of the
+    buffers of all geometries
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param thread_count maximum number of threads to use
+ */
+template
+<
+    typename Geometries,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_all(Geometries const& geometries,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count = 1)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    concepts::check<geometry_type const>();
+    concepts::check<polygon_type>();
+
+    geometry_out.clear();
+    detail::parallel_buffer::apply(geometries, geometry_out,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy,
+            thread_count == 0 ? 1 : thread_count);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_BUFFER_HPP
@@ -0,0 +1,375 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
+
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/iterators/point_iterator.hpp>
+
+#include <boost/geometry/policies/predicate_based_interrupt_policy.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/algorithms/detail/for_each_index.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel_is_valid
+{
+
+
+// Validates each element of a range, each element gets its own failure type
+template <typename Geometries>
+struct element_task
+{
+    inline element_task(Geometries const& geometries,
+                std::vector<validity_failure_type>& failures)
+        : m_geometries(geometries)
+        , m_failures(failures)
+    {}
+
+    inline void apply(std::size_t index) const
+    {
+        geometry::is_valid(range::at(m_geometries, index), m_failures[index]);
+    }
+
+    Geometries const& m_geometries;
+    std::vector<validity_failure_type>& m_failures;
+};
+
+
+// Returns the first failure of the range, or no_failure
+inline validity_failure_type
+first_failure(std::vector<validity_failure_type> const& failures)
+{
+    for (std::size_t i = 0; i < failures.size(); i++)
+    {
+        if (failures[i] != no_failure)
+        {
+            return failures[i];
+        }
+    }
+    return no_failure;
+}
+
+
+// Turns between two different polygons of a multi-polygon are only
+// acceptable if they touch (the same as is_acceptable_turn does for
+// turns with different multi-indices)
+template <typename MultiPolygon>
+class is_acceptable_interaction
+    : is_valid::is_acceptable_turn
+        <
+            typename boost::range_value<MultiPolygon>::type
+        >
+{
+    typedef is_valid::is_acceptable_turn
+        <
+            typename boost::range_value<MultiPolygon>::type
+        > base;
+
+public :
+    template <typename Turn>
+    static inline bool apply(Turn const& turn)
+    {
+        using namespace detail::overlay;
+
+        operation_type const op
+            = is_valid::acceptable_operation<MultiPolygon>::value;
+
+        return base::check_turn(turn, method_touch_interior, op)
+            || base::check_turn(turn, method_touch, op)
+            ;
+    }
+};
+
+
+// Checks the interaction of two (valid) polygons of a multi-polygon, whose
+// envelopes intersect. They should only touch, and not be nested.
+template <typename MultiPolygon>
+struct interaction_task
+{
+    typedef std::pair<std::size_t, std::size_t> pair_type;
+
+    typedef typename geometry::point_type<MultiPolygon>::type point_type;
+    typedef typename geometry::rescale_policy_type
+        <
+            point_type
+        >::type rescale_policy_type;
+    typedef typename is_valid::has_valid_self_turns
+        <
+            MultiPolygon
+        >::turn_type turn_type;
+
+    inline interaction_task(MultiPolygon const& multi_polygon,
+                std::vector<pair_type> const& pairs,
+                std::vector<validity_failure_type>& failures)
+        : m_multi_polygon(multi_polygon)
+        , m_pairs(pairs)
+        , m_failures(failures)
+    {}
+
+    inline void apply(std::size_t index) const
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        polygon_type const& first
+            = range::at(m_multi_polygon, m_pairs[index].first);
+        polygon_type const& second
+            = range::at(m_multi_polygon, m_pairs[index].second);
+
+        rescale_policy_type const robust_policy
+            = geometry::get_rescale_policy<rescale_policy_type>(first, second);
+
+        detail::overlay::stateless_predicate_based_interrupt_policy
+            <
+                is_acceptable_interaction<MultiPolygon>
+            > interrupt_policy;
+
+        std::vector<turn_type> turns;
+        geometry::get_turns
+            <
+                false, false, detail::overlay::assign_null_policy
+            >(first, second, robust_policy, turns, interrupt_policy);
+
+        if (interrupt_policy.has_intersections)
+        {
+            m_failures[index] = failure_self_intersections;
+        }
+        else if (turns.empty()
+                 && (geometry::within(*points_begin(first), second)
+                     || geometry::within(*points_begin(second), first)))
+        {
+            m_failures[index] = failure_intersecting_interiors;
+        }
+        else
+        {
+            m_failures[index] = no_failure;
+        }
+    }
+
+    MultiPolygon const& m_multi_polygon;
+    std::vector<pair_type> const& m_pairs;
+    std::vector<validity_failure_type>& m_failures;
+};
+
+
+// Collects the pairs of polygons whose envelopes intersect
+template <typename MultiPolygon>
+inline void interacting_pairs(MultiPolygon const& multi_polygon,
+            std::vector<std::pair<std::size_t, std::size_t> >& pairs)
+{
+    typedef model::box
+        <
+            typename geometry::point_type<MultiPolygon>::type
+        > box_type;
+    typedef std::pair<box_type, std::size_t> value_type;
+    typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+
+    std::vector<value_type> values;
+    values.reserve(boost::size(multi_polygon));
+
+    std::size_t index = 0;
+    for (typename boost::range_iterator<MultiPolygon const>::type
+            it = boost::begin(multi_polygon);
+         it != boost::end(multi_polygon);
+         ++it, ++index)
+    {
+        values.push_back(value_type(geometry::return_envelope<box_type>(*it),
+                                    index));
+    }
+
+    // Construction from a range uses the packing algorithm
+    rtree_type const tree(values);
+
+    std::vector<value_type> found;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        found.clear();
+        tree.query(index::intersects(values[i].first),
+                   std::back_inserter(found));
+        for (std::size_t j = 0; j < found.size(); j++)
+        {
+            if (found[j].second > i)
+            {
+                pairs.push_back(std::make_pair(i, found[j].second));
+            }
+        }
+    }
+}
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct parallel_is_valid
+{
+    static inline validity_failure_type apply(Geometry const& geometry,
+                std::size_t )
+    {
+        validity_failure_type failure = no_failure;
+        geometry::is_valid(geometry, failure);
+        return failure;
+    }
+};
+
+
+// A multi-linestring is valid if all its linestrings are valid
+template <typename MultiLinestring>
+struct parallel_is_valid<MultiLinestring, multi_linestring_tag>
+{
+    static inline validity_failure_type apply(MultiLinestring const& multi,
+                std::size_t thread_count)
+    {
+        std::vector<validity_failure_type> failures(boost::size(multi),
+                                                    no_failure);
+        parallel::for_each_index(
+            element_task<MultiLinestring>(multi, failures),
+            failures.size(), thread_count);
+        return first_failure(failures);
+    }
+};
+
+
+// A multi-polygon is valid if all its polygons are valid, and if each
+// pair of polygons only touches. Both phases are executed in parallel.
+template <typename MultiPolygon>
+struct parallel_is_valid<MultiPolygon, multi_polygon_tag>
+{
+    static inline validity_failure_type apply(MultiPolygon const& multi,
+                std::size_t thread_count)
+    {
+        std::vector<validity_failure_type> failures(boost::size(multi),
+                                                    no_failure);
+        parallel::for_each_index(
+            element_task<MultiPolygon>(multi, failures),
+            failures.size(), thread_count);
+
+        validity_failure_type const failure = first_failure(failures);
+        if (failure != no_failure)
+        {
+            return failure;
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t> > pairs;
+        interacting_pairs(multi, pairs);
+
+        failures.assign(pairs.size(), no_failure);
+        parallel::for_each_index(
+            interaction_task<MultiPolygon>(multi, pairs, failures),
+            failures.size(), thread_count);
+        return first_failure(failures);
+    }
+};
+
+
+}} // namespace detail::parallel_is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks if a geometry is valid (in the OGC sense), using multiple threads
+\ingroup is_valid
+\details For a multi-polygon, all polygons are validated in parallel.
+    If they are all valid, all pairs of polygons with intersecting envelopes
+    are checked in parallel to only touch each other. For a
+    multi-linestring, all linestrings are validated in parallel. Other
+    geometries are validated sequentially. If the compiler does not support
+    C++11 threads, validation is sequential.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param failure An enumeration value indicating that the geometry is
+    valid or not, and if not valid indicating the reason why. If the
+    geometry is invalid because of several reasons, the reason of the
+    first invalid polygon or pair of polygons is given.
+\param thread_count maximum number of threads to use
+\return \return_check{is valid (in the OGC sense)}
+*/
+template <typename Geometry>
+inline bool is_valid(Geometry const& geometry,
+            validity_failure_type& failure,
+            std::size_t thread_count)
+{
+    concepts::check<Geometry const>();
+
+    failure = detail::parallel_is_valid::parallel_is_valid
+        <
+            Geometry
+        >::apply(geometry, thread_count == 0 ? 1 : thread_count);
+    return failure == no_failure;
+}
+
+
+/*!
+\brief Checks all geometries of a range for validity (in the OGC sense),
+    using multiple threads
+\ingroup is_valid
+\details Each geometry of the range is validated by one of the threads.
+    If the compiler does not support C++11 threads, validation is
+    sequential.
+\tparam Geometries range of geometries
+\param geometries the geometries to validate
+\param failures the failure type of each geometry, in the same order
+    as the input (no_failure for valid geometries)
+\param thread_count maximum number of threads to use
+\return true if all geometries are valid
+*/
+template <typename Geometries>
+inline bool is_valid_each(Geometries const& geometries,
+            std::vector<validity_failure_type>& failures,
+            std::size_t thread_count = 1)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    concepts::check<geometry_type const>();
+
+    failures.assign(boost::size(geometries), no_failure);
+    detail::parallel::for_each_index(
+        detail::parallel_is_valid::element_task<Geometries>(geometries,
+                                                             failures),
+        failures.size(), thread_count == 0 ? 1 : thread_count);
+
+    return detail::parallel_is_valid::first_failure(failures) == no_failure;
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
@@ -249,7 +249,8 @@ struct rescale_policy_type
     : public detail::get_rescale_policy::rescale_policy_type
     <
         Point,
-#if defined(BOOST_GEOMETRY_NO_ROBUSTNESS)
+#if defined(BOOST_GEOMETRY_NO_ROBUSTNESS) || defined(BOOST_GEOMETRY_SIDE_ROBUST)
+        // Without rescaling, or with an exact side strategy
         false
 #else
         boost::is_floating_point
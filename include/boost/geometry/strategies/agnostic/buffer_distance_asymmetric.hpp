@@ -30,6 +30,10 @@ namespace strategy { namespace buffer
     It can be applied for (multi)linestrings. It uses a (potentially) different
     distances for left and for right. This means the (multi)linestrings are
     interpreted having a direction.
+    Before buffering, the input is simplified with a tolerance of a
+    fraction (by default 0.001) of the smallest distance. The Hausdorff
+    distance between the buffer of the simplified input and the buffer of
+    the input is at most that tolerance.
 
 \qbk{
 [heading Example]
@@ -48,10 +52,14 @@ public :
     //! \brief Constructs the strategy, two distances must be specified
     //! \param left The distance (or radius) of the buffer on the left side
     //! \param right The distance on the right side
+    //! \param simplify_fraction The fraction of the smallest distance used
+    //!     as tolerance to simplify the input before the buffer process
     distance_asymmetric(NumericType const& left,
-                NumericType const& right)
+                NumericType const& right,
+                double simplify_fraction = 0.001)
         : m_left(left)
         , m_right(right)
+        , m_simplify_divisor(1.0 / simplify_fraction)
     {}
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -95,7 +103,7 @@ public :
     {
         NumericType const left = geometry::math::abs(m_left);
         NumericType const right = geometry::math::abs(m_right);
-        return (std::min)(left, right) / 1000.0;
+        return (std::min)(left, right) / m_simplify_divisor;
     }
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -103,6 +111,9 @@ public :
 private :
     NumericType m_left;
     NumericType m_right;
+    // Stored as a divisor: the default fraction divides by exactly
+    // 1000, keeping the simplify distance of the default unchanged
+    double m_simplify_divisor;
 };
 
 
@@ -20,9 +20,11 @@
 
 
 #include <cstddef>
+#include <algorithm>
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
+#include <utility>
 #include <vector>
 
 #include <boost/range.hpp>
@@ -47,30 +49,6 @@ namespace strategy { namespace simplify
 namespace detail
 {
 
-    /*!
-        \brief Small wrapper around a point, with an extra member "included"
-        \details
-            It has a const-reference to the original point (so no copy here)
-        \tparam the enclosed point type
-    */
-    template<typename Point>
-    struct douglas_peucker_point
-    {
-        Point const& p;
-        bool included;
-
-        inline douglas_peucker_point(Point const& ap)
-            : p(ap)
-            , included(false)
-        {}
-
-        // Necessary for proper compilation
-        inline douglas_peucker_point<Point> operator=(douglas_peucker_point<Point> const& )
-        {
-            return douglas_peucker_point<Point>(*this);
-        }
-    };
-
     template
     <
         typename Point,
@@ -110,129 +88,102 @@ namespace detail
         {}
 
     private :
-        typedef detail::douglas_peucker_point<Point> dp_point_type;
-        typedef typename std::vector<dp_point_type>::iterator iterator_type;
-
 
         LessCompare const& less() const
         {
             return *this;
         }
 
-        inline void consider(iterator_type begin,
-                             iterator_type end,
-                             distance_type const& max_dist,
-                             int& n,
-                             distance_strategy_type const& ps_distance_strategy) const
-        {
-            std::size_t size = end - begin;
+    public :
 
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
-            {
+        // The sections of the range still to be considered are kept on an
+        // explicit stack (instead of recursion, which might overflow the
+        // call stack for long ranges). The section on top of the stack is
+        // always the leftmost section, so a section which does not need to
+        // be split further is final, and its first point can be written
+        // to the output directly. Points are accessed in the input range,
+        // they are not copied.
+        template <typename Range, typename OutputIterator>
+        inline OutputIterator apply(Range const& range,
+                                    OutputIterator out,
+                                    distance_type max_distance) const
+        {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
-                {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
-                }
-                std::cout << "return because size=" << size << std::endl;
+                std::cout << "max distance: " << max_distance
+                          << std::endl << std::endl;
 #endif
-                return;
-            }
+            typedef typename boost::range_iterator<Range const>::type iterator_type;
+            // A section, by the iterators to its first and last point
+            typedef std::pair<iterator_type, iterator_type> section_type;
 
-            iterator_type last = end - 1;
+            distance_strategy_type strategy;
 
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
-#endif
+            if (boost::size(range) <= 1)
+            {
+                // Nothing to simplify, and the last point should not be
+                // written twice
+                return std::copy(boost::begin(range), boost::end(range), out);
+            }
 
+            std::vector<section_type> stack;
+            stack.push_back(section_type(boost::begin(range),
+                                         boost::end(range) - 1));
 
-            // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
-            for(iterator_type it = begin + 1; it != last; ++it)
+            while (! stack.empty())
             {
-                distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
+                iterator_type const first = stack.back().first;
+                iterator_type const last = stack.back().second;
+                stack.pop_back();
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "consider " << dsv(it->p)
-                    << " at " << double(dist)
-                    << ((dist > max_dist) ? " maybe" : " no")
-                    << std::endl;
-
+                std::cout << "find between " << dsv(*first)
+                    << " and " << dsv(*last)
+                    << " size=" << (last - first + 1) << std::endl;
 #endif
-                if ( less()(md, dist) )
+
+                // Find most far point, compare to the current segment
+                distance_type md(-1.0); // any value < 0
+                iterator_type candidate = last;
+                if (last - first >= 2)
                 {
-                    md = dist;
-                    candidate = it;
-                }
-            }
+                    for (iterator_type it = first + 1; it != last; ++it)
+                    {
+                        distance_type dist = strategy.apply(*it, *first, *last);
 
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
-            if ( less()(max_dist, md) )
-            {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
+                        std::cout << "consider " << dsv(*it)
+                            << " at " << double(dist)
+                            << ((dist > max_distance) ? " maybe" : " no")
+                            << std::endl;
 #endif
+                        if ( less()(md, dist) )
+                        {
+                            md = dist;
+                            candidate = it;
+                        }
+                    }
+                }
 
-                candidate->included = true;
-                n++;
-
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
-            }
-        }
-
-
-    public :
-
-        template <typename Range, typename OutputIterator>
-        inline OutputIterator apply(Range const& range,
-                                    OutputIterator out,
-                                    distance_type max_distance) const
-        {
+                if (candidate != last && less()(max_distance, md))
+                {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "max distance: " << max_distance
-                          << std::endl << std::endl;
+                    std::cout << "use " << dsv(*candidate) << std::endl;
 #endif
-            distance_strategy_type strategy;
-
-            // Copy coordinates, a vector of references to all points
-            std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                            boost::end(range));
-
-            // Include first and last point of line,
-            // they are always part of the line
-            int n = 2;
-            ref_candidates.front().included = true;
-            ref_candidates.back().included = true;
-
-            // Get points, recursively, including them if they are further away
-            // than the specified distance
-            consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n, strategy);
-
-            // Copy included elements to the output
-            for(typename std::vector<dp_point_type>::const_iterator it
-                            = boost::begin(ref_candidates);
-                it != boost::end(ref_candidates);
-                ++it)
-            {
-                if (it->included)
+                    // Split the section at the candidate, the left part is
+                    // considered first
+                    stack.push_back(section_type(candidate, last));
+                    stack.push_back(section_type(first, candidate));
+                }
+                else
                 {
-                    // copy-coordinates does not work because OutputIterator
-                    // does not model Point (??)
-                    //geometry::convert(it->p, *out);
-                    *out = it->p;
+                    *out = *first;
                     out++;
                 }
             }
+
+            // The last point of the line is always part of the line
+            *out = *(boost::end(range) - 1);
+            out++;
             return out;
         }
 
@@ -305,17 +256,6 @@ public :
 }} // namespace strategy::simplify
 
 
-namespace traits {
-
-template <typename P>
-struct point_type<geometry::strategy::simplify::detail::douglas_peucker_point<P> >
-{
-    typedef P type;
-};
-
-} // namespace traits
-
-
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_DOUGLAS_PEUCKER_HPP
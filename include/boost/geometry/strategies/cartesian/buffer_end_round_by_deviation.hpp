@@ -0,0 +1,116 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_END_ROUND_BY_DEVIATION_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_END_ROUND_BY_DEVIATION_HPP
+
+#include <algorithm>
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_end_round.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_points_per_circle.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace strategy { namespace buffer
+{
+
+
+/*!
+\brief Let the buffer create rounded ends, with a maximum deviation
+\ingroup strategies
+\details This strategy can be used as EndStrategy for the buffer algorithm.
+    It creates a rounded end for each linestring-end, like end_round.
+    The number of points is calculated per end from the buffer distance,
+    such that the distance between the generated segments and the exact
+    arc is at most the specified deviation.
+    This strategy is only applicable for Cartesian coordinate systems.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_end_round end_round]
+}
+ */
+class end_round_by_deviation
+{
+public :
+
+    //! \brief Constructs the strategy
+    //! \param max_deviation maximum distance between the generated segments
+    //!     and the exact arc (positive)
+    explicit inline end_round_by_deviation(double max_deviation)
+        : m_max_deviation(max_deviation)
+    {
+        BOOST_GEOMETRY_ASSERT(max_deviation > 0);
+    }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+    //! Fills output_range with a round end
+    template <typename Point, typename RangeOut, typename DistanceStrategy>
+    inline void apply(Point const& penultimate_point,
+                Point const& perp_left_point,
+                Point const& ultimate_point,
+                Point const& perp_right_point,
+                buffer_side_selector side,
+                DistanceStrategy const& distance,
+                RangeOut& range_out) const
+    {
+        typedef typename geometry::select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                double
+            >::type promoted_type;
+
+        // For asymmetric distances, the radius of the end is the average
+        // of both distances, the largest distance is taken to be sure
+        promoted_type const dist_left = distance.apply(penultimate_point,
+                ultimate_point, buffer_side_left);
+        promoted_type const dist_right = distance.apply(penultimate_point,
+                ultimate_point, buffer_side_right);
+        promoted_type const radius = (std::max)(
+                geometry::math::abs(dist_left),
+                geometry::math::abs(dist_right));
+
+        end_round const end(detail::points_per_circle<promoted_type>(
+                radius, m_max_deviation));
+        end.apply(penultimate_point, perp_left_point, ultimate_point,
+                perp_right_point, side, distance, range_out);
+    }
+
+    template <typename NumericType>
+    static inline NumericType max_distance(NumericType const& distance)
+    {
+        return distance;
+    }
+
+    //! Returns the piece_type (round end)
+    static inline piece_type get_piece_type()
+    {
+        return buffered_round_end;
+    }
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private :
+    double m_max_deviation;
+};
+
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_END_ROUND_BY_DEVIATION_HPP
@@ -0,0 +1,95 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_JOIN_ROUND_BY_DEVIATION_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_JOIN_ROUND_BY_DEVIATION_HPP
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_join_round.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_points_per_circle.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace strategy { namespace buffer
+{
+
+/*!
+\brief Let the buffer create rounded corners, with a maximum deviation
+\ingroup strategies
+\details This strategy can be used as JoinStrategy for the buffer algorithm.
+    It creates a rounded corners around each convex vertex, like join_round.
+    The number of points is not fixed per circle, but calculated per corner
+    from the buffer distance and the angle of the corner, such that the
+    distance between the generated segments and the exact arc is at most
+    the specified deviation. Small buffers get fewer points, large buffers
+    more points than with a fixed number of points per circle.
+    This strategy is only applicable for Cartesian coordinate systems.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_join_round join_round]
+}
+ */
+class join_round_by_deviation
+{
+public :
+
+    //! \brief Constructs the strategy
+    //! \param max_deviation maximum distance between the generated segments
+    //!     and the exact arc (positive)
+    explicit inline join_round_by_deviation(double max_deviation)
+        : m_max_deviation(max_deviation)
+    {
+        BOOST_GEOMETRY_ASSERT(max_deviation > 0);
+    }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    //! Fills output_range with a rounded shape around a vertex
+    template <typename Point, typename DistanceType, typename RangeOut>
+    inline bool apply(Point const& ip, Point const& vertex,
+                Point const& perp1, Point const& perp2,
+                DistanceType const& buffer_distance,
+                RangeOut& range_out) const
+    {
+        typedef typename geometry::select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                double
+            >::type promoted_type;
+
+        join_round const join(detail::points_per_circle<promoted_type>(
+                buffer_distance, m_max_deviation));
+        return join.apply(ip, vertex, perp1, perp2, buffer_distance, range_out);
+    }
+
+    template <typename NumericType>
+    static inline NumericType max_distance(NumericType const& distance)
+    {
+        return distance;
+    }
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private :
+    double m_max_deviation;
+};
+
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_JOIN_ROUND_BY_DEVIATION_HPP
@@ -0,0 +1,56 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINTS_PER_CIRCLE_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINTS_PER_CIRCLE_HPP
+
+#include <cmath>
+#include <cstddef>
+
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace buffer
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Returns the number of points for a full circle with the specified radius,
+// such that the distance between each chord and the arc it replaces is at
+// most max_deviation. For a chord over an angle a, this distance (the
+// sagitta) is radius * (1 - cos(a / 2)).
+template <typename T>
+inline std::size_t points_per_circle(T const& radius, T const& max_deviation)
+{
+    T const two_pi = geometry::math::two_pi<T>();
+
+    T const r = geometry::math::abs(radius);
+    if (! (r > max_deviation))
+    {
+        // Any chord is within the deviation, the minimum number of points
+        // is applied by the strategies
+        return 1;
+    }
+
+    T const max_angle = 2.0 * std::acos(1.0 - max_deviation / r);
+    return static_cast<std::size_t>(std::ceil(two_pi / max_angle));
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINTS_PER_CIRCLE_HPP
@@ -36,6 +36,7 @@
 // Temporary / will be Strategy as template parameter
 #include <boost/geometry/strategies/side.hpp>
 #include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/strategies/cartesian/side_robust.hpp>
 
 #include <boost/geometry/strategies/side_info.hpp>
 #include <boost/geometry/strategies/intersection.hpp>
@@ -200,7 +201,11 @@ struct relate_cartesian_segments
         typedef typename select_calculation_type
             <Segment1, Segment2, CalculationType>::type coordinate_type;
 
+#if defined(BOOST_GEOMETRY_SIDE_ROBUST)
+        typedef side::side_robust<coordinate_type> side;
+#else
         typedef side::side_by_triangle<coordinate_type> side;
+#endif
 
         side_info sides;
         sides.set<0>(side::apply(robust_b1, robust_b2, robust_a1),
@@ -31,6 +31,10 @@
 #include <boost/geometry/algorithms/detail/relate/less.hpp>
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
 
+#if defined(BOOST_GEOMETRY_SIDE_ROBUST)
+#include <boost/geometry/strategies/cartesian/side_robust.hpp>
+#endif
+
 
 namespace boost { namespace geometry
 {
@@ -250,7 +254,11 @@ namespace services
 template <typename CalculationType>
 struct default_strategy<cartesian_tag, CalculationType>
 {
+#if defined(BOOST_GEOMETRY_SIDE_ROBUST)
+    typedef side_robust<CalculationType> type;
+#else
     typedef side_by_triangle<CalculationType> type;
+#endif
 };
 
 }
@@ -0,0 +1,144 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
+
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_void.hpp>
+
+#include <boost/geometry/arithmetic/determinant.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/precise_math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace side
+{
+
+/*!
+\brief Check at which side of a segment a point lies:
+    left of segment (> 0), right of segment (< 0), on segment (0)
+\ingroup strategies
+\details The side is calculated by an adaptive precision orientation
+    predicate. The determinant is calculated in floating point and only
+    if the result is too close to zero to be sure about its sign, it is
+    calculated exactly, using floating point expansions. Therefore the
+    side is always correct, for all floating point input, without using
+    an epsilon. Calculation types which are not floating point types
+    (for example arbitrary precision numbers) calculate the determinant
+    directly.
+    Define BOOST_GEOMETRY_SIDE_ROBUST to make this the default side
+    strategy for cartesian coordinates (and to let overlay run without
+    rescaling to integer coordinates).
+\tparam CalculationType \tparam_calculation
+ */
+template <typename CalculationType = void>
+class side_robust
+{
+    template <typename PromotedType, bool IsFloatingPoint>
+    struct compute_side_value
+    {
+        static inline PromotedType apply(PromotedType const& x1,
+                    PromotedType const& y1, PromotedType const& x2,
+                    PromotedType const& y2, PromotedType const& x,
+                    PromotedType const& y)
+        {
+            return geometry::detail::determinant<PromotedType>
+                (
+                    x2 - x1, y2 - y1,
+                    x - x1, y - y1
+                );
+        }
+    };
+
+    template <typename PromotedType>
+    struct compute_side_value<PromotedType, true>
+    {
+        static inline PromotedType apply(PromotedType const& x1,
+                    PromotedType const& y1, PromotedType const& x2,
+                    PromotedType const& y2, PromotedType const& x,
+                    PromotedType const& y)
+        {
+            return geometry::detail::precise_math::orient2d(x1, y1,
+                                                            x2, y2, x, y);
+        }
+    };
+
+public :
+
+    // Returns a value with the correct sign of twice the area of the
+    // triangle (p1, p2, p). Its magnitude is approximate if the exact
+    // calculation was necessary.
+    template
+    <
+        typename CoordinateType,
+        typename PromotedType,
+        typename P1,
+        typename P2,
+        typename P
+    >
+    static inline
+    PromotedType side_value(P1 const& p1, P2 const& p2, P const& p)
+    {
+        return compute_side_value
+            <
+                PromotedType,
+                boost::is_floating_point<PromotedType>::value
+            >::apply(PromotedType(get<0>(p1)), PromotedType(get<1>(p1)),
+                     PromotedType(get<0>(p2)), PromotedType(get<1>(p2)),
+                     PromotedType(get<0>(p)), PromotedType(get<1>(p)));
+    }
+
+    template <typename P1, typename P2, typename P>
+    static inline int apply(P1 const& p1, P2 const& p2, P const& p)
+    {
+        typedef typename boost::mpl::if_c
+            <
+                boost::is_void<CalculationType>::type::value,
+                typename select_most_precise
+                    <
+                        typename select_most_precise
+                            <
+                                typename coordinate_type<P1>::type,
+                                typename coordinate_type<P2>::type
+                            >::type,
+                        typename coordinate_type<P>::type
+                    >::type,
+                CalculationType
+            >::type coordinate_type;
+
+        // Promote float->double, small int->int
+        typedef typename select_most_precise
+            <
+                coordinate_type,
+                double
+            >::type promoted_type;
+
+        promoted_type const s
+            = side_value<coordinate_type, promoted_type>(p1, p2, p);
+
+        promoted_type const zero = promoted_type();
+        return s > zero ? 1
+            : s < zero ? -1
+            : 0;
+    }
+};
+
+
+}} // namespace strategy::side
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
@@ -0,0 +1,188 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
+#define BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include <boost/geometry/util/math.hpp>
+
+// The floating point expansion arithmetic and the adaptive orientation
+// predicate in this file are based on:
+// Jonathan Richard Shewchuk, Adaptive Precision Floating-Point Arithmetic
+// and Fast Robust Geometric Predicates, Discrete & Computational Geometry
+// 18(3):305-363, October 1997.
+// They assume binary floating point arithmetic with round-to-nearest,
+// without extended precision for intermediate results.
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace precise_math
+{
+
+
+// Returns the machine epsilon of Shewchuk: half the distance between 1 and
+// the next floating point value
+template <typename T>
+inline T half_epsilon()
+{
+    return std::numeric_limits<T>::epsilon() / T(2);
+}
+
+// Returns 2^ceil(p/2) + 1, p being the number of bits of the mantissa,
+// used to split a value into two halves of p/2 bits
+template <typename T>
+inline T splitter()
+{
+    return std::ldexp(T(1), (std::numeric_limits<T>::digits + 1) / 2) + T(1);
+}
+
+
+// x + y = a + b exactly, x being the rounded sum
+template <typename T>
+inline void two_sum(T const& a, T const& b, T& x, T& y)
+{
+    x = a + b;
+    T const b_virtual = x - a;
+    T const a_virtual = x - b_virtual;
+    T const b_roundoff = b - b_virtual;
+    T const a_roundoff = a - a_virtual;
+    y = a_roundoff + b_roundoff;
+}
+
+// x + y = a * b exactly, x being the rounded product
+template <typename T>
+inline void two_product(T const& a, T const& b, T& x, T& y)
+{
+    T const split = splitter<T>();
+
+    x = a * b;
+
+    T c = split * a;
+    T const a_high = c - (c - a);
+    T const a_low = a - a_high;
+    c = split * b;
+    T const b_high = c - (c - b);
+    T const b_low = b - b_high;
+
+    T const err1 = x - a_high * b_high;
+    T const err2 = err1 - a_low * b_high;
+    T const err3 = err2 - a_high * b_low;
+    y = a_low * b_low - err3;
+}
+
+// Adds value b to the nonoverlapping expansion e (with count components,
+// in increasing order of magnitude). The result is written to h, which
+// may be the same as e. Zero components are eliminated.
+// Returns the number of components of h.
+template <typename T>
+inline std::size_t grow_expansion(T const* e, std::size_t count, T const& b,
+                                  T* h)
+{
+    T q = b;
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        T sum, roundoff;
+        two_sum(q, e[i], sum, roundoff);
+        q = sum;
+        if (roundoff != T(0))
+        {
+            h[result++] = roundoff;
+        }
+    }
+    if (q != T(0) || result == 0)
+    {
+        h[result++] = q;
+    }
+    return result;
+}
+
+
+// Returns a value with the sign of the determinant
+//   | ax-cx  ay-cy |
+//   | bx-cx  by-cy |
+// which is positive if a, b, c are in counterclockwise order (c is left of
+// the directed line a->b), negative if they are clockwise, and zero if they
+// are collinear. The determinant is first calculated in floating point.
+// Only if it is too close to zero to be certain about its sign, it is
+// calculated exactly.
+template <typename T>
+inline T orient2d(T const& ax, T const& ay, T const& bx, T const& by,
+                  T const& cx, T const& cy)
+{
+    T const det_left = (ax - cx) * (by - cy);
+    T const det_right = (ay - cy) * (bx - cx);
+    T const det = det_left - det_right;
+
+    T det_sum;
+    if (det_left > T(0))
+    {
+        if (det_right <= T(0))
+        {
+            return det;
+        }
+        det_sum = det_left + det_right;
+    }
+    else if (det_left < T(0))
+    {
+        if (det_right >= T(0))
+        {
+            return det;
+        }
+        det_sum = -det_left - det_right;
+    }
+    else
+    {
+        return det;
+    }
+
+    T const epsilon = half_epsilon<T>();
+    T const error_factor = (T(3) + T(16) * epsilon) * epsilon;
+    if (math::abs(det) >= error_factor * det_sum)
+    {
+        return det;
+    }
+
+    // Calculate the exact determinant as the sum of six products
+    //   ax*by - ax*cy - cx*by - ay*bx + ay*cx + cy*bx
+    // each of them being represented exactly by two components
+    T const factors[6][2] =
+        {
+            { ax, by }, { -ax, cy }, { -cx, by },
+            { -ay, bx }, { ay, cx }, { cy, bx }
+        };
+
+    T expansion[13];
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < 6; i++)
+    {
+        T high, low;
+        two_product(factors[i][0], factors[i][1], high, low);
+        count = grow_expansion(expansion, count, low, expansion);
+        count = grow_expansion(expansion, count, high, expansion);
+    }
+
+    // The components are nonoverlapping and in increasing order of
+    // magnitude, so the largest component has the sign of the determinant
+    // (and approximates it)
+    return expansion[count - 1];
+}
+
+
+}} // namespace detail::precise_math
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
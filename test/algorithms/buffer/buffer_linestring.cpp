@@ -312,6 +312,72 @@ void test_invalid()
     test_one<linestring, polygon>("mysql_report_2015_04_10g", mysql_report_2015_04_10g, join_round32, end_round32, 86527.871, 100.0);
 }
 
+template <typename Ring, typename Polygon>
+double max_vertex_distance(Ring const& ring, Polygon const& polygon)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    bg::model::linestring<point_type> boundary;
+    boundary.assign(bg::exterior_ring(polygon).begin(),
+                    bg::exterior_ring(polygon).end());
+
+    double result = 0.0;
+    for (typename boost::range_iterator<Ring const>::type it = boost::begin(ring);
+         it != boost::end(ring); ++it)
+    {
+        result = (std::max)(result, bg::distance(*it, boundary));
+    }
+    return result;
+}
+
+template <bool Clockwise, typename P>
+void test_simplify_fraction()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P, Clockwise> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // A dense track with some noise, like a GPS track
+    linestring track;
+    for (int i = 0; i < 2000; i++)
+    {
+        double const x = i * 0.05;
+        double const noise = (i % 3 - 1) * 0.02;
+        track.push_back(P(x, 3.0 * std::sin(x / 10.0) + noise));
+    }
+
+    double const distance = 5.0;
+    double const fraction = 0.02;
+    double const tolerance = distance * fraction;
+
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy(90);
+    bg::strategy::buffer::end_round end_strategy(90);
+    bg::strategy::buffer::point_circle point_strategy(90);
+
+    multi_polygon buffered, simplified;
+    bg::buffer(track, buffered,
+               bg::strategy::buffer::distance_symmetric<double>(distance),
+               side_strategy, join_strategy, end_strategy, point_strategy);
+    bg::buffer(track, simplified,
+               bg::strategy::buffer::distance_symmetric<double>(distance, fraction),
+               side_strategy, join_strategy, end_strategy, point_strategy);
+
+    BOOST_CHECK_EQUAL(buffered.size(), 1u);
+    BOOST_CHECK_EQUAL(simplified.size(), 1u);
+    if (buffered.size() != 1 || simplified.size() != 1)
+    {
+        return;
+    }
+
+    // Far fewer vertices, and the boundaries deviate at most the tolerance
+    // (apart from the approximation of the round joins)
+    BOOST_CHECK_LT(bg::num_points(simplified) * 4, bg::num_points(buffered));
+    BOOST_CHECK_LE(max_vertex_distance(bg::exterior_ring(simplified.front()),
+                                       buffered.front()), tolerance * 1.1);
+    BOOST_CHECK_LE(max_vertex_distance(bg::exterior_ring(buffered.front()),
+                                       simplified.front()), tolerance * 1.1);
+}
+
 #ifdef HAVE_TTMATH
 #include <ttmath_stub.hpp>
 #endif
@@ -324,6 +390,7 @@ int test_main(int, char* [])
     //test_all<bg::model::point<tt, 2, bg::cs::cartesian> >();
 
     test_invalid<true, bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_simplify_fraction<true, bg::model::point<double, 2, bg::cs::cartesian> >();
 //    test_invalid<true, bg::model::point<long double, 2, bg::cs::cartesian> >();
     return 0;
 }
@@ -701,6 +701,92 @@ void test_mixed()
             simplex, join_round, end_flat, 47.4831, 1.5);
 }
 
+template <typename Polygon, typename JoinStrategy>
+void test_convex_inset(std::string const& caseid, std::string const& wkt,
+                JoinStrategy const& join_strategy, double distance)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::rescale_policy_type<point_type>::type
+        rescale_policy_type;
+
+    Polygon polygon;
+    bg::read_wkt(wkt, polygon);
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::end_flat end_strategy;
+    bg::strategy::buffer::point_square point_strategy;
+
+    // Via the convex fast path (if applicable)
+    bg::model::multi_polygon<Polygon> result;
+    bg::buffer(polygon, result, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+
+    // Via the generic algorithm (the fast path is not used with a visitor)
+    bg::model::box<point_type> envelope;
+    bg::envelope(polygon, envelope);
+    rescale_policy_type rescale_policy
+            = bg::get_rescale_policy<rescale_policy_type>(envelope);
+    bg::detail::buffer::visit_pieces_default_policy visitor;
+    bg::model::multi_polygon<Polygon> expected;
+    bg::detail::buffer::buffer_inserter<Polygon>(polygon,
+            std::back_inserter(expected),
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy, rescale_policy, visitor);
+
+    BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+        caseid << " count: " << result.size()
+               << " expected: " << expected.size());
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result), caseid << " not valid");
+}
+
+template <bool Clockwise, typename P>
+void test_convex_inset()
+{
+    typedef bg::model::polygon<P, Clockwise> polygon;
+
+    bg::strategy::buffer::join_miter join_miter;
+    bg::strategy::buffer::join_round join_round(36);
+
+    std::ostringstream circle;
+    circle << "POLYGON((";
+    for (int i = 0; i <= 200; i++)
+    {
+        double const angle = (Clockwise ? -2.0 : 2.0) * i
+            * boost::math::constants::pi<double>() / 200.0;
+        circle << (i > 0 ? "," : "")
+               << 10.0 * std::cos(angle) << " " << 10.0 * std::sin(angle);
+    }
+    circle << "))";
+
+    std::string const simplex_rev = Clockwise
+        ? simplex : "POLYGON ((0 0,6 1,1 5,0 0))";
+    std::string const square_rev = Clockwise
+        ? square_simplex : "POLYGON ((0 0,1 0,1 1,0 1,0 0))";
+    std::string const rectangle_rev = Clockwise
+        ? "POLYGON((0 0,0 2,4 2,4 0,0 0))" : "POLYGON((0 0,4 0,4 2,0 2,0 0))";
+    std::string const circle_rev = circle.str();
+
+    test_convex_inset<polygon>("simplex", simplex_rev, join_miter, -0.2);
+    test_convex_inset<polygon>("simplex_round", simplex_rev, join_round, -0.5);
+    test_convex_inset<polygon>("simplex_eroded", simplex_rev, join_miter, -2.0);
+    test_convex_inset<polygon>("square", square_rev, join_miter, -0.1);
+    test_convex_inset<polygon>("square_eroded", square_rev, join_miter, -0.5);
+    test_convex_inset<polygon>("rectangle", rectangle_rev, join_miter, -0.5);
+    test_convex_inset<polygon>("rectangle_collapsed", rectangle_rev, join_miter, -1.0);
+    test_convex_inset<polygon>("rectangle_nearly_collapsed", rectangle_rev, join_miter, -0.9999999);
+    test_convex_inset<polygon>("circle", circle_rev, join_round, -3.0);
+    test_convex_inset<polygon>("circle_eroded", circle_rev, join_round, -10.5);
+
+    if (BOOST_GEOMETRY_CONDITION(Clockwise))
+    {
+        // Not convex, or with interior rings: generic algorithm
+        test_convex_inset<polygon>("concave", concave_simplex, join_miter, -0.2);
+        test_convex_inset<polygon>("donut", donut_simplex, join_miter, -0.2);
+    }
+}
+
 #ifdef HAVE_TTMATH
 #include <ttmath_stub.hpp>
 #endif
@@ -712,6 +798,9 @@ int test_main(int, char* [])
     test_all<true, dpoint>();
     test_all<false, dpoint>();
 
+    test_convex_inset<true, dpoint>();
+    test_convex_inset<false, dpoint>();
+
 #if ! defined(BOOST_GEOMETRY_TEST_ONLY_ONE_TYPE)
 
     test_mixed<dpoint, dpoint, false, false, true, true>();
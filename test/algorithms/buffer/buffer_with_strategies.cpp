@@ -131,8 +131,46 @@ void test_all()
         35.2257, 166);
 }
 
+template <bool Clockwise, typename Point>
+void test_by_deviation()
+{
+    typedef bg::model::polygon<Point, Clockwise> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::join_round_by_deviation join(0.001);
+    bg::strategy::buffer::end_round_by_deviation end(0.001);
+    bg::strategy::buffer::point_circle_by_deviation circle(0.001);
+    bg::strategy::buffer::side_straight side;
+
+    typedef bg::strategy::buffer::distance_symmetric
+    <
+        typename bg::coordinate_type<Point>::type
+    > distance;
+
+    // A circle with radius 1 gets 71 points, with radius 100 703 points
+    test_with_strategies<Point, multi_polygon>(
+        "point_1", "POINT(0 0)",
+        join, end, side, circle, distance(1.0),
+        3.1374, 72, 0.001);
+    test_with_strategies<Point, multi_polygon>(
+        "point_100", "POINT(0 0)",
+        join, end, side, circle, distance(100.0),
+        31415.5, 704, 0.5);
+
+    test_with_strategies<bg::model::linestring<Point>, multi_polygon>(
+        "linestring", "LINESTRING(0 0,4 0,4 4)",
+        join, end, side, circle, distance(1.0),
+        18.9219, 95, 0.001);
+
+    test_with_strategies<polygon, multi_polygon>(
+        "polygon_simplex", polygon_simplex,
+        join, end, side, circle, distance(1.0),
+        35.2257, 77);
+}
+
 int test_main(int, char* [])
 {
     test_all<true, bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_by_deviation<true, bg::model::point<double, 2, bg::cs::cartesian> >();
     return 0;
 }
@@ -76,7 +76,7 @@ struct box_visitor
     {}
 
     template <typename Item>
-    inline void apply(Item const& item1, Item const& item2)
+    inline bool apply(Item const& item1, Item const& item2)
     {
         if (bg::intersects(item1.box, item2.box))
         {
@@ -85,6 +85,7 @@ struct box_visitor
             area += bg::area(b);
             count++;
         }
+        return true;
     }
 };
 
@@ -96,12 +97,13 @@ struct point_in_box_visitor
     {}
 
     template <typename Point, typename BoxItem>
-    inline void apply(Point const& point, BoxItem const& box_item)
+    inline bool apply(Point const& point, BoxItem const& box_item)
     {
         if (bg::within(point, box_item.box))
         {
             count++;
         }
+        return true;
     }
 };
 
@@ -113,12 +115,13 @@ struct reversed_point_in_box_visitor
     {}
 
     template <typename BoxItem, typename Point>
-    inline void apply(BoxItem const& box_item, Point const& point)
+    inline bool apply(BoxItem const& box_item, Point const& point)
     {
         if (bg::within(point, box_item.box))
         {
             count++;
         }
+        return true;
     }
 };
 
@@ -194,12 +197,13 @@ struct point_visitor
     {}
 
     template <typename Item>
-    inline void apply(Item const& item1, Item const& item2)
+    inline bool apply(Item const& item1, Item const& item2)
     {
         if (bg::equals(item1, item2))
         {
             count++;
         }
+        return true;
     }
 };
 
@@ -639,6 +643,58 @@ void test_heterogenuous_collections(int seed1, int seed2, int size, int count)
     BOOST_CHECK_EQUAL(visitor2.count, expected_count);
 }
 
+// Visitor interrupting the partition after a number of overlapping pairs
+struct interrupting_box_visitor
+{
+    int count;
+    int max_count;
+
+    explicit interrupting_box_visitor(int m)
+        : count(0)
+        , max_count(m)
+    {}
+
+    template <typename Item1, typename Item2>
+    inline bool apply(Item1 const& item1, Item2 const& item2)
+    {
+        BOOST_CHECK_MESSAGE(count < max_count, "Visited after interruption");
+        if (bg::intersects(item1.box, item2.box))
+        {
+            count++;
+        }
+        return count < max_count;
+    }
+};
+
+void test_interrupt(int seed1, int seed2, int size, int count)
+{
+    typedef bg::model::box<point_item> box_type;
+    std::vector<box_item<box_type> > boxes1, boxes2;
+
+    fill_boxes(boxes1, seed1, size, count);
+    fill_boxes(boxes2, seed2, size, count);
+
+    typedef bg::partition<box_type, get_box, ovelaps_box> partition_type;
+
+    for (int max_count = 1; max_count < 10; max_count++)
+    {
+        interrupting_box_visitor visitor1(max_count);
+        BOOST_CHECK(! partition_type::apply(boxes1, visitor1, 2));
+        BOOST_CHECK_EQUAL(visitor1.count, max_count);
+
+        interrupting_box_visitor visitor2(max_count);
+        BOOST_CHECK(! partition_type::apply(boxes1, boxes2, visitor2, 2));
+        BOOST_CHECK_EQUAL(visitor2.count, max_count);
+    }
+
+    // Without interruption, partition visits all and returns true
+    box_visitor<box_type> visitor;
+    BOOST_CHECK(partition_type::apply(boxes1, visitor, 2));
+    interrupting_box_visitor visitor3(visitor.count + 1);
+    BOOST_CHECK(partition_type::apply(boxes1, visitor3, 2));
+    BOOST_CHECK_EQUAL(visitor3.count, visitor.count);
+}
+
 int test_main( int , char* [] )
 {
     test_all<bg::model::d2::point_xy<double> >();
@@ -663,5 +719,7 @@ int test_main( int , char* [] )
 
     test_heterogenuous_collections(67890, 98765, 20, 60);
 
+    test_interrupt(12345, 54321, 20, 40);
+
     return 0;
 }
@@ -17,9 +17,13 @@
 
 #include <geometry_test_common.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
 #include <boost/geometry/algorithms/make.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_boxes.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
@@ -350,11 +354,280 @@ void test_large_integers()
 
 }
 
+void test_filtered()
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+    bg::model::linestring<point_type> ls;
+    bg::read_wkt("LINESTRING(0 0,1 0,2 0,3 0,3 1,3 2,2 2,1 2)", ls);
+
+    // Only the segments touching the box are sectionalized
+    box_type const box(point_type(2.5, -1.0), point_type(5.0, 5.0));
+    bg::detail::sectionalize::box_segment_filter<box_type> const filter(box);
+
+    bg::sections<box_type, 2> s;
+    bg::detail::sectionalize::sectionalize_filtered<false, dimensions>(ls,
+            bg::detail::no_rescale_policy(), filter, s, 0, 10);
+
+    BOOST_CHECK_EQUAL(s.size(), 3u);
+    if (s.size() != 3u)
+    {
+        return;
+    }
+
+    BOOST_CHECK_EQUAL(s[0].begin_index, 2);
+    BOOST_CHECK_EQUAL(s[0].end_index, 3);
+    BOOST_CHECK_EQUAL(s[1].begin_index, 3);
+    BOOST_CHECK_EQUAL(s[1].end_index, 5);
+    BOOST_CHECK_EQUAL(s[2].begin_index, 5);
+    BOOST_CHECK_EQUAL(s[2].end_index, 6);
+
+    // The first and last segment of the linestring are filtered out
+    BOOST_CHECK(! s[0].is_non_duplicate_first);
+    BOOST_CHECK(! s[2].is_non_duplicate_last);
+
+    // With a box containing the whole linestring, it is the same as without
+    box_type const large_box(point_type(-1.0, -1.0), point_type(5.0, 5.0));
+    bg::detail::sectionalize::sectionalize_filtered<false, dimensions>(ls,
+            bg::detail::no_rescale_policy(),
+            bg::detail::sectionalize::box_segment_filter<box_type>(large_box),
+            s, 0, 10);
+
+    BOOST_CHECK_EQUAL(s.size(), 3u);
+    if (s.size() == 3u)
+    {
+        BOOST_CHECK(s[0].is_non_duplicate_first);
+        BOOST_CHECK(s[2].is_non_duplicate_last);
+    }
+}
+
+struct count_pairs_visitor
+{
+    std::size_t count;
+    std::size_t max_count;
+    count_pairs_visitor(std::size_t m = 0) : count(0), max_count(m) {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! bg::detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box))
+        {
+            count++;
+        }
+        return max_count == 0 || count < max_count;
+    }
+};
+
+template <typename CSTag, typename Sections>
+std::size_t count_overlapping(Sections const& sections1,
+                              Sections const& sections2)
+{
+    count_pairs_visitor visitor;
+    bg::detail::section::visit_sections<CSTag>::apply(sections1, sections2,
+                                                      visitor);
+    return visitor.count;
+}
+
+// Lists the indices of the overlapping sections, in the order visited
+template <typename Sections>
+struct list_pairs_visitor
+{
+    Sections const& sections1;
+    Sections const& sections2;
+    std::vector<std::pair<std::size_t, std::size_t> > pairs;
+
+    list_pairs_visitor(Sections const& s1, Sections const& s2)
+        : sections1(s1), sections2(s2)
+    {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! bg::detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box))
+        {
+            pairs.push_back(std::make_pair(
+                std::size_t(&sec1 - &sections1.front()),
+                std::size_t(&sec2 - &sections2.front())));
+        }
+        return true;
+    }
+};
+
+template <typename CSTag, typename Sections>
+std::vector<std::pair<std::size_t, std::size_t> >
+    overlapping_pairs(Sections const& sections1, Sections const& sections2)
+{
+    list_pairs_visitor<Sections> visitor(sections1, sections2);
+    bg::detail::section::visit_sections<CSTag>::apply(sections1, sections2,
+                                                      visitor);
+    return visitor.pairs;
+}
+
+template <typename CSTag, typename Sections>
+std::size_t count_overlapping(Sections const& sections)
+{
+    count_pairs_visitor visitor;
+    bg::detail::section::visit_sections<CSTag>::apply(sections, visitor);
+    return visitor.count;
+}
+
+void test_visit_sections()
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+    bg::model::polygon<point_type> poly1, poly2;
+    bg::read_wkt("POLYGON((0 0,0 4,1 5,2 4,3 5,4 4,4 0,3 1,2 0,1 1,0 0))", poly1);
+    bg::read_wkt("POLYGON((1 -1,1 3,2 6,3 3,3 -1,2 2,1 -1))", poly2);
+
+    sections_type sections1, sections2;
+    bg::sectionalize<false, dimensions>(poly1, bg::detail::no_rescale_policy(),
+            sections1, 0, 1);
+    bg::sectionalize<false, dimensions>(poly2, bg::detail::no_rescale_policy(),
+            sections2, 1, 1);
+
+    // Sweeping the boxes (cartesian) should visit the same pairs as
+    // partition (generic)
+    std::size_t const expected
+        = count_overlapping<bg::spherical_equatorial_tag>(sections1, sections2);
+    BOOST_CHECK(expected > 0);
+    BOOST_CHECK_EQUAL(count_overlapping<bg::cartesian_tag>(sections1, sections2),
+                      expected);
+    BOOST_CHECK_EQUAL(count_overlapping<bg::cartesian_tag>(sections2, sections1),
+                      expected);
+
+    std::size_t const expected_self
+        = count_overlapping<bg::spherical_equatorial_tag>(sections1);
+    BOOST_CHECK(expected_self > 0);
+    BOOST_CHECK_EQUAL(count_overlapping<bg::cartesian_tag>(sections1),
+                      expected_self);
+
+    // Many sections of one collection are swept
+    bg::model::linestring<point_type> track;
+    for (int row = 0; row < 10; row++)
+    {
+        for (int i = 0; i <= 20; i++)
+        {
+            bg::append(track, point_type(row % 2 == 0 ? i : 20 - i,
+                                         row + (i % 3) * 0.5));
+        }
+    }
+    sections_type track_sections;
+    bg::sectionalize<false, dimensions>(track, bg::detail::no_rescale_policy(),
+            track_sections, 0, 2);
+    BOOST_CHECK(track_sections.size() > 16u);
+
+    std::size_t const expected_track
+        = count_overlapping<bg::spherical_equatorial_tag>(track_sections);
+    BOOST_CHECK(expected_track > 0);
+    BOOST_CHECK_EQUAL(count_overlapping<bg::cartesian_tag>(track_sections),
+                      expected_track);
+
+    // A small collection against a large collection: the same pairs in
+    // the same order as partition
+    BOOST_CHECK(! overlapping_pairs<bg::spherical_equatorial_tag>(
+                    track_sections, sections2).empty());
+    BOOST_CHECK(overlapping_pairs<bg::cartesian_tag>(track_sections, sections2)
+        == overlapping_pairs<bg::spherical_equatorial_tag>(track_sections, sections2));
+    BOOST_CHECK(overlapping_pairs<bg::cartesian_tag>(sections2, track_sections)
+        == overlapping_pairs<bg::spherical_equatorial_tag>(sections2, track_sections));
+
+    // The sweep stops when the visitor returns false
+    count_pairs_visitor interrupting(3);
+    BOOST_CHECK(! bg::detail::section::visit_sections
+                    <
+                        bg::cartesian_tag
+                    >::apply(track_sections, interrupting));
+    BOOST_CHECK_EQUAL(interrupting.count, 3u);
+
+    // Two sections of 15 segments (16 points of 16 bytes) fit in 512 bytes
+    BOOST_CHECK_EQUAL(bg::detail::sectionalize::max_count_for_footprint
+                        <point_type>(512), 15u);
+}
+
+void test_apply_sections()
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+    typedef bg::detail::overlay::turn_info
+        <
+            point_type,
+            bg::segment_ratio<double>
+        > turn_type;
+    typedef bg::detail::overlay::get_turn_info
+        <
+            bg::detail::overlay::assign_null_policy
+        > turn_policy;
+    typedef bg::detail::get_turns::get_turns_generic
+        <
+            polygon_type, polygon_type, false, false, turn_policy
+        > generic_type;
+
+    bg::detail::no_rescale_policy const robust_policy;
+    bg::detail::self_get_turn_points::no_interrupt_policy interrupt_policy;
+
+    polygon_type poly1, poly2, poly3;
+    bg::read_wkt("POLYGON((0 0,0 4,1 5,2 4,3 5,4 4,4 0,3 1,2 0,1 1,0 0))", poly1);
+    bg::read_wkt("POLYGON((1 -1,1 3,2 6,3 3,3 -1,2 2,1 -1))", poly2);
+    bg::read_wkt("POLYGON((-1 2,-1 3,5 3,5 2,-1 2))", poly3);
+
+    // The sections of poly1 are created once, and used against two polygons
+    sections_type sections1, sections2, sections3;
+    bg::sectionalize<false, dimensions>(poly1, robust_policy, sections1, 0);
+    bg::sectionalize<false, dimensions>(poly2, robust_policy, sections2, 1);
+    bg::sectionalize<false, dimensions>(poly3, robust_policy, sections3, 1);
+
+    std::vector<turn_type> turns, expected;
+    generic_type::apply_sections(0, poly1, sections1, 1, poly2, sections2,
+            robust_policy, turns, interrupt_policy);
+    generic_type::apply(0, poly1, 1, poly2,
+            robust_policy, expected, interrupt_policy);
+    BOOST_CHECK(! expected.empty());
+    BOOST_CHECK_EQUAL(turns.size(), expected.size());
+
+    turns.clear();
+    expected.clear();
+    generic_type::apply_sections(0, poly1, sections1, 1, poly3, sections3,
+            robust_policy, turns, interrupt_policy);
+    generic_type::apply(0, poly1, 1, poly3,
+            robust_policy, expected, interrupt_policy);
+    BOOST_CHECK(! expected.empty());
+    BOOST_CHECK_EQUAL(turns.size(), expected.size());
+
+    // Self turns of a self-intersecting polygon
+    polygon_type bowtie;
+    bg::read_wkt("POLYGON((0 0,0 2,2 0,2 2,0 0))", bowtie);
+    typedef bg::sections<box_type, 1> self_sections_type;
+    self_sections_type self_sections;
+    bg::sectionalize<false, boost::mpl::vector_c<std::size_t, 0> >(bowtie,
+            robust_policy, self_sections, 0);
+
+    turns.clear();
+    expected.clear();
+    bg::detail::self_get_turn_points::get_turns<turn_policy>::apply_sections(
+            bowtie, self_sections, robust_policy, turns, interrupt_policy);
+    bg::self_turns<turn_policy>(bowtie, robust_policy, expected,
+                                interrupt_policy);
+    BOOST_CHECK(! expected.empty());
+    BOOST_CHECK_EQUAL(turns.size(), expected.size());
+}
 
 
 int test_main(int, char* [])
 {
     test_large_integers();
+    test_filtered();
+    test_visit_sections();
+    test_apply_sections();
 
     //test_all<bg::model::d2::point_xy<float> >();
     test_all<bg::model::d2::point_xy<double> >();
@@ -0,0 +1,145 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef BOOST_TEST_MODULE
+#define BOOST_TEST_MODULE test_discrete_frechet_distance
+#endif
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/geometry/algorithms/discrete_frechet_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = ::boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+
+// Calculates the discrete Frechet distance with the full n*m table
+template <typename Linestring, typename Strategy>
+double full_table_frechet(Linestring const& ls1, Linestring const& ls2,
+                          Strategy const& strategy)
+{
+    std::size_t const n = ls1.size();
+    std::size_t const m = ls2.size();
+    std::vector<std::vector<double> > table(n, std::vector<double>(m));
+    for (std::size_t i = 0; i < n; i++)
+    {
+        for (std::size_t j = 0; j < m; j++)
+        {
+            double const d = bg::distance(ls1[i], ls2[j], strategy);
+            if (i == 0 && j == 0)
+            {
+                table[i][j] = d;
+            }
+            else if (i == 0)
+            {
+                table[i][j] = (std::max)(table[i][j - 1], d);
+            }
+            else if (j == 0)
+            {
+                table[i][j] = (std::max)(table[i - 1][j], d);
+            }
+            else
+            {
+                double const best = (std::min)(table[i - 1][j],
+                    (std::min)(table[i - 1][j - 1], table[i][j - 1]));
+                table[i][j] = (std::max)(best, d);
+            }
+        }
+    }
+    return table[n - 1][m - 1];
+}
+
+template <typename Linestring>
+void test_linestrings(std::string const& wkt1, std::string const& wkt2,
+                      double expected)
+{
+    Linestring ls1, ls2;
+    bg::read_wkt(wkt1, ls1);
+    bg::read_wkt(wkt2, ls2);
+
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls1, ls2),
+                      expected, 0.0001);
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls2, ls1),
+                      expected, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_frechet_distance_cartesian )
+{
+    test_linestrings<linestring_type>(
+        "linestring(0 0,1 1,2 0)", "linestring(0 0,1 1,2 0)", 0.0);
+    test_linestrings<linestring_type>(
+        "linestring(0 0,1 1,2 0)", "linestring(0 1,1 2,2 1)", 1.0);
+    test_linestrings<linestring_type>(
+        "linestring(0 0,10 0)", "linestring(0 0,5 0,10 0)", 5.0);
+    // Direction matters (unlike for the Hausdorff distance)
+    test_linestrings<linestring_type>(
+        "linestring(0 0,10 0)", "linestring(10 0,0 0)", 10.0);
+    test_linestrings<linestring_type>(
+        "linestring(0 0)", "linestring(3 4,6 8)", 10.0);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_frechet_distance_long )
+{
+    linestring_type ls1, ls2;
+    for (int i = 0; i < 300; i++)
+    {
+        double const x = i * 0.1;
+        ls1.push_back(point_type(x, std::sin(x)));
+    }
+    for (int i = 0; i < 200; i++)
+    {
+        double const x = i * 0.15;
+        ls2.push_back(point_type(x, std::sin(x + 0.3) + 0.1));
+    }
+
+    bg::strategy::distance::pythagoras<> const strategy;
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls1, ls2),
+                      full_table_frechet(ls1, ls2, strategy), 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_frechet_distance_spherical )
+{
+    typedef bg::model::point
+        <
+            double, 2, bg::cs::spherical_equatorial<bg::degree>
+        > sph_point;
+    typedef bg::model::linestring<sph_point> sph_linestring;
+
+    sph_linestring ls1, ls2;
+    for (int i = 0; i < 50; i++)
+    {
+        ls1.push_back(sph_point(i * 0.5, 10.0 + std::sin(i * 0.1)));
+        ls2.push_back(sph_point(i * 0.6 + 0.2, 10.5 + std::cos(i * 0.1)));
+    }
+
+    bg::strategy::distance::haversine<double> const strategy(6371.0);
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls1, ls2, strategy),
+                      full_table_frechet(ls1, ls2, strategy), 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_frechet_distance_empty )
+{
+    linestring_type empty;
+    linestring_type ls;
+    bg::read_wkt("linestring(0 0,1 1)", ls);
+    BOOST_CHECK_THROW(bg::discrete_frechet_distance(ls, empty),
+                      bg::empty_input_exception);
+}
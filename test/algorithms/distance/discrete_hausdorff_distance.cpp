@@ -0,0 +1,139 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#ifndef BOOST_TEST_MODULE
+#define BOOST_TEST_MODULE test_discrete_hausdorff_distance
+#endif
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/geometry/algorithms/discrete_hausdorff_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = ::boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+
+// Calculates the Hausdorff distance by visiting all pairs of points
+template <typename Range1, typename Range2, typename Strategy>
+double brute_force_hausdorff(Range1 const& range1, Range2 const& range2,
+                             Strategy const& strategy)
+{
+    double result = 0;
+    for (std::size_t i = 0; i < range1.size(); i++)
+    {
+        double closest = -1;
+        for (std::size_t j = 0; j < range2.size(); j++)
+        {
+            double const d = bg::distance(range1[i], range2[j], strategy);
+            if (closest < 0 || d < closest)
+            {
+                closest = d;
+            }
+        }
+        result = (std::max)(result, closest);
+    }
+    return result;
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_geometries(std::string const& wkt1, std::string const& wkt2,
+                     double expected)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(geometry1, geometry2),
+                      expected, 0.0001);
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(geometry2, geometry1),
+                      expected, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_hausdorff_distance_cartesian )
+{
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,1 1,2 0)", "linestring(0 0,1 1,2 0)", 0.0);
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,1 1,2 0)", "linestring(0 1,1 2,2 1)", 1.0);
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,10 0)", "linestring(0 0,10 0,10 3)", 3.0);
+    // Only vertices are considered: (5 0) is 5 away from the closest vertex
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,10 0)", "linestring(0 0,5 0,10 0,10 3)", 5.0);
+    test_geometries<linestring_type, multi_point_type>(
+        "linestring(0 0,10 0)", "multipoint((0 4),(10 0))", 4.0);
+    test_geometries<multi_point_type, multi_point_type>(
+        "multipoint((0 0),(3 4))", "multipoint((0 0))", 5.0);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_hausdorff_distance_long )
+{
+    // Compared with all pairs of points, for the r-tree version (cartesian)
+    linestring_type ls1, ls2;
+    for (int i = 0; i < 500; i++)
+    {
+        double const x = i * 0.1;
+        ls1.push_back(point_type(x, std::sin(x)));
+        ls2.push_back(point_type(x * 1.03, std::cos(x * 0.9) + 0.2));
+    }
+
+    bg::strategy::distance::pythagoras<> const strategy;
+    double const expected = (std::max)(
+        brute_force_hausdorff(ls1, ls2, strategy),
+        brute_force_hausdorff(ls2, ls1, strategy));
+
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, ls2),
+                      expected, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_hausdorff_distance_spherical )
+{
+    typedef bg::model::point
+        <
+            double, 2, bg::cs::spherical_equatorial<bg::degree>
+        > sph_point;
+    typedef bg::model::linestring<sph_point> sph_linestring;
+
+    sph_linestring ls1, ls2;
+    for (int i = 0; i < 100; i++)
+    {
+        ls1.push_back(sph_point(i * 0.5, 10.0 + std::sin(i * 0.1)));
+        ls2.push_back(sph_point(i * 0.5 + 0.2, 10.5 + std::cos(i * 0.1)));
+    }
+
+    bg::strategy::distance::haversine<double> const strategy(6371.0);
+    double const expected = (std::max)(
+        brute_force_hausdorff(ls1, ls2, strategy),
+        brute_force_hausdorff(ls2, ls1, strategy));
+
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, ls2, strategy),
+                      expected, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( test_discrete_hausdorff_distance_empty )
+{
+    linestring_type empty;
+    linestring_type ls;
+    bg::read_wkt("linestring(0 0,1 1)", ls);
+    BOOST_CHECK_THROW(bg::discrete_hausdorff_distance(empty, ls),
+                      bg::empty_input_exception);
+}
@@ -251,6 +251,55 @@ void test_distance_multilinestring_multilinestring(Strategy const& strategy)
 
 //===========================================================================
 
+template <typename Strategy>
+void test_distance_long_linestrings(Strategy const& strategy)
+{
+#ifdef BOOST_GEOMETRY_TEST_DEBUG
+    std::cout << std::endl;
+    std::cout << "long linestring/linestring distance tests" << std::endl;
+#endif
+
+    // Two interleaving spirals, with many segments close to the other
+    // linestring, compared with the distance of all segment pairs
+    for (int c = 0; c < 3; c++)
+    {
+        double const offset = c * 0.3;
+        linestring_type ls1, ls2;
+        for (int i = 0; i < 1000; i++)
+        {
+            double const angle = i * 0.05;
+            double const radius1 = 1.0 + i * 0.01;
+            double const radius2 = 1.3 + offset + i * 0.01;
+            ls1.push_back(point_type(radius1 * std::cos(angle),
+                                     radius1 * std::sin(angle)));
+            ls2.push_back(point_type(radius2 * std::cos(angle + 0.02),
+                                     radius2 * std::sin(angle + 0.02)));
+        }
+
+        return_type expected = -1;
+        typedef bg::segment_iterator<linestring_type const> iterator_type;
+        for (iterator_type it1 = bg::segments_begin(ls1);
+             it1 != bg::segments_end(ls1); ++it1)
+        {
+            for (iterator_type it2 = bg::segments_begin(ls2);
+                 it2 != bg::segments_end(ls2); ++it2)
+            {
+                return_type const d = bg::distance(*it1, *it2, strategy);
+                if (expected < 0 || d < expected)
+                {
+                    expected = d;
+                }
+            }
+        }
+
+        BOOST_CHECK_CLOSE(bg::distance(ls1, ls2, strategy), expected, 0.0001);
+        BOOST_CHECK_CLOSE(bg::comparable_distance(ls1, ls2, strategy),
+                          expected * expected, 0.0001);
+    }
+}
+
+//===========================================================================
+
 template <typename Point, typename Strategy>
 void test_more_empty_input_linear_linear(Strategy const& strategy)
 {
@@ -314,6 +363,11 @@ BOOST_AUTO_TEST_CASE( test_all_multilinestring_multilinestring )
     test_distance_multilinestring_multilinestring(point_segment_strategy());
 }
 
+BOOST_AUTO_TEST_CASE( test_all_long_linestrings )
+{
+    test_distance_long_linestrings(point_segment_strategy());
+}
+
 BOOST_AUTO_TEST_CASE( test_all_empty_input_linear_linear )
 {
     test_more_empty_input_linear_linear<point_type>(point_segment_strategy());
@@ -0,0 +1,161 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#ifndef BOOST_TEST_MODULE
+#define BOOST_TEST_MODULE test_is_within_distance
+#endif
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/is_within_distance.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = ::boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::segment<point_type> segment_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+
+// Checks is_within_distance against the distance, with a maximum distance
+// just below, equal to and just above the distance
+template <typename Geometry1, typename Geometry2>
+void test_geometries(std::string const& wkt1, std::string const& wkt2,
+                     double expected_distance)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    double const distance = bg::distance(geometry1, geometry2);
+    BOOST_CHECK_CLOSE(distance, expected_distance, 0.0001);
+
+    BOOST_CHECK_MESSAGE(bg::is_within_distance(geometry1, geometry2,
+                                               distance + 0.001),
+        wkt1 << " " << wkt2 << " should be within " << distance + 0.001);
+    BOOST_CHECK_MESSAGE(bg::is_within_distance(geometry2, geometry1,
+                                               distance + 0.001),
+        wkt2 << " " << wkt1 << " should be within " << distance + 0.001);
+
+    if (distance > 0.001)
+    {
+        BOOST_CHECK_MESSAGE(! bg::is_within_distance(geometry1, geometry2,
+                                                     distance - 0.001),
+            wkt1 << " " << wkt2 << " should not be within "
+                 << distance - 0.001);
+        BOOST_CHECK_MESSAGE(! bg::is_within_distance(geometry2, geometry1,
+                                                     distance - 0.001),
+            wkt2 << " " << wkt1 << " should not be within "
+                 << distance - 0.001);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_linear )
+{
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,10 0)", "linestring(0 2,10 3)", 2.0);
+    test_geometries<linestring_type, linestring_type>(
+        "linestring(0 0,10 0)", "linestring(5 -1,5 1)", 0.0);
+    test_geometries<linestring_type, multi_linestring_type>(
+        "linestring(0 0,10 0)",
+        "multilinestring((20 20,30 30),(12 1,14 3))", std::sqrt(5.0));
+    test_geometries<segment_type, linestring_type>(
+        "segment(0 0,10 0)", "linestring(0 2,10 3)", 2.0);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_areal )
+{
+    std::string const square = "polygon((0 0,0 10,10 10,10 0,0 0))";
+    std::string const donut
+        = "polygon((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))";
+
+    test_geometries<linestring_type, polygon_type>(
+        "linestring(12 0,12 10)", square, 2.0);
+    test_geometries<linestring_type, polygon_type>(
+        "linestring(4 5,6 5)", square, 0.0);
+    test_geometries<linestring_type, polygon_type>(
+        "linestring(4 5,6 5)", donut, 2.0);
+    test_geometries<polygon_type, polygon_type>(
+        "polygon((4 4,4 6,6 6,6 4,4 4))", square, 0.0);
+    test_geometries<polygon_type, polygon_type>(
+        "polygon((4 4,4 6,6 6,6 4,4 4))", donut, 2.0);
+    test_geometries<polygon_type, multi_polygon_type>(square,
+        "multipolygon(((20 0,20 10,30 10,20 0)),((13 0,13 1,14 1,13 0)))",
+        3.0);
+    test_geometries<point_type, polygon_type>("point(5 5)", donut, 3.0);
+    test_geometries<multi_point_type, polygon_type>(
+        "multipoint((5 5),(15 5))", donut, 3.0);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_long_linestrings )
+{
+    // Two sine waves, the closest points are far from their ends
+    linestring_type ls1, ls2;
+    for (int i = 0; i < 5000; i++)
+    {
+        double const x = i * 0.01;
+        ls1.push_back(point_type(x, std::sin(x)));
+        ls2.push_back(point_type(x, 3.0 - std::sin(x + 0.5)));
+    }
+
+    double const distance = bg::distance(ls1, ls2);
+    BOOST_CHECK(bg::is_within_distance(ls1, ls2, distance + 1.0e-6));
+    BOOST_CHECK(! bg::is_within_distance(ls1, ls2, distance - 1.0e-6));
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_spherical )
+{
+    typedef bg::model::point
+        <
+            double, 2, bg::cs::spherical_equatorial<bg::degree>
+        > sph_point;
+    sph_point const p1(0, 0);
+    sph_point const p2(1, 0);
+
+    bg::strategy::distance::haversine<double> const strategy(6371.0);
+    double const distance = bg::distance(p1, p2, strategy);
+    BOOST_CHECK(bg::is_within_distance(p1, p2, distance + 0.001, strategy));
+    BOOST_CHECK(! bg::is_within_distance(p1, p2, distance - 0.001, strategy));
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_empty )
+{
+    linestring_type empty;
+    linestring_type ls;
+    bg::read_wkt("linestring(0 0,1 1)", ls);
+    BOOST_CHECK(! bg::is_within_distance(empty, ls, 100.0));
+    BOOST_CHECK(! bg::is_within_distance(ls, empty, 100.0));
+}
+
+BOOST_AUTO_TEST_CASE( test_is_within_distance_negative )
+{
+    polygon_type square;
+    linestring_type ls;
+    point_type const p(1, 1);
+    bg::read_wkt("polygon((0 0,0 10,10 10,10 0,0 0))", square);
+    bg::read_wkt("linestring(4 5,6 5)", ls);
+
+    // A negative maximum distance is never reached, not even inside
+    BOOST_CHECK(! bg::is_within_distance(p, square, -1.0));
+    BOOST_CHECK(! bg::is_within_distance(ls, square, -1.0));
+    BOOST_CHECK(! bg::is_within_distance(p, p, -1.0));
+    BOOST_CHECK(bg::is_within_distance(p, square, 0.0));
+}
@@ -33,6 +33,7 @@
 
 #include <boost/geometry/io/wkt/wkt.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 #include <boost/geometry/algorithms/is_valid.hpp>
 #include <boost/geometry/algorithms/is_simple.hpp>
@@ -202,6 +203,47 @@ BOOST_AUTO_TEST_CASE( test_is_simple_linestring )
     test_simple(from_wkt<G>("LINESTRING()"), false, false);
 }
 
+BOOST_AUTO_TEST_CASE( test_is_simple_long_linestring )
+{
+#ifdef BOOST_GEOMETRY_TEST_DEBUG
+    std::cout << std::endl << std::endl;
+    std::cout << "************************************" << std::endl;
+    std::cout << " is_simple: LONG LINESTRING " << std::endl;
+    std::cout << "************************************" << std::endl;
+#endif
+
+    typedef linestring_type G;
+
+    // A track going back and forth over 20 rows, having many sections
+    G track;
+    for (int row = 0; row < 20; row++)
+    {
+        for (int i = 0; i <= 100; i++)
+        {
+            int const x = row % 2 == 0 ? i : 100 - i;
+            bg::append(track, point_type(x, row + (i % 2) * 0.25));
+        }
+    }
+    test_simple(track, true);
+
+    // Going back to the first row crosses all the rows
+    bg::append(track, point_type(50.5, -1.0));
+    test_simple(track, false);
+
+    // Two rows: a section can be passed before the preceding section,
+    // whose last segment neighbours its first segment
+    G two_rows;
+    for (int row = 0; row < 2; row++)
+    {
+        for (int i = 0; i < 80; i++)
+        {
+            int const x = row % 2 == 0 ? i : 79 - i;
+            bg::append(two_rows, point_type(x, row * 2.0 + (i % 2) * 0.5));
+        }
+    }
+    test_simple(two_rows, true);
+}
+
 BOOST_AUTO_TEST_CASE( test_is_simple_multilinestring )
 {
 #ifdef BOOST_GEOMETRY_TEST_DEBUG
@@ -0,0 +1,155 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/math/constants/constants.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/overlay/assign_parents.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_properties.hpp>
+
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Ring>
+Ring make_circle(double cx, double cy, double radius, int count)
+{
+    Ring ring;
+    double const pi = boost::math::constants::pi<double>();
+    // Clockwise
+    for (int i = count; i >= 0; i--)
+    {
+        double const angle = 2.0 * pi * (i % count) / count;
+        bg::append(ring, typename bg::point_type<Ring>::type(
+            cx + radius * std::cos(angle), cy + radius * std::sin(angle)));
+    }
+    return ring;
+}
+
+template <typename Ring>
+Ring make_hole(double x, double y, double size)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    Ring ring;
+    // Counter clockwise
+    bg::append(ring, point_type(x, y));
+    bg::append(ring, point_type(x + size, y));
+    bg::append(ring, point_type(x + size, y + size));
+    bg::append(ring, point_type(x, y + size));
+    bg::append(ring, point_type(x, y));
+    return ring;
+}
+
+template <typename P>
+void test_many_holes()
+{
+    typedef bg::model::ring<P> ring_type;
+    typedef bg::model::polygon<P> polygon_type;
+    typedef bg::detail::overlay::ring_properties<P> properties;
+    typedef std::map<bg::ring_identifier, properties> map_type;
+
+    // Three outer rings: two of them nested, and one separate, having
+    // enough points to be indexed when they are tested for several holes
+    std::vector<ring_type> rings;
+    rings.push_back(make_circle<ring_type>(0.0, 0.0, 10.0, 256));
+    rings.push_back(make_circle<ring_type>(0.0, 0.0, 4.0, 128));
+    rings.push_back(make_circle<ring_type>(30.0, 0.0, 5.0, 100));
+    std::size_t const outer_count = rings.size();
+
+    // Small holes, not crossing any of the outer rings
+    for (double x = -12.0; x < 36.0; x += 1.25)
+    {
+        for (double y = -12.0; y < 12.0; y += 1.25)
+        {
+            ring_type const hole = make_hole<ring_type>(x, y, 0.5);
+            bool crossing = false;
+            for (std::size_t i = 0; i < outer_count && ! crossing; i++)
+            {
+                for (std::size_t j = 1; j < 4 && ! crossing; j++)
+                {
+                    crossing = bg::covered_by(hole[0], rings[i])
+                            != bg::covered_by(hole[j], rings[i]);
+                }
+            }
+            if (! crossing)
+            {
+                rings.push_back(hole);
+            }
+        }
+    }
+
+    map_type ring_map;
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        ring_map[bg::ring_identifier(2, i, -1)] = properties(rings[i]);
+    }
+
+    polygon_type empty;
+    bg::detail::overlay::assign_parents(empty, rings, ring_map, false);
+
+    // The parent of a hole is the smallest outer ring containing it
+    std::size_t with_parent = 0;
+    for (std::size_t i = outer_count; i < rings.size(); i++)
+    {
+        int expected = -1;
+        for (std::size_t j = 0; j < outer_count; j++)
+        {
+            if (bg::within(ring_map[bg::ring_identifier(2, i, -1)].point, rings[j])
+                && (expected == -1
+                    || bg::area(rings[j]) < bg::area(rings[expected])))
+            {
+                expected = static_cast<int>(j);
+            }
+        }
+
+        properties const& hole = ring_map[bg::ring_identifier(2, i, -1)];
+        if (expected == -1)
+        {
+            BOOST_CHECK_EQUAL(hole.parent.source_index, -1);
+        }
+        else
+        {
+            with_parent++;
+            BOOST_CHECK_EQUAL(hole.parent.source_index, 2);
+            BOOST_CHECK_EQUAL(hole.parent.multi_index, expected);
+        }
+    }
+    BOOST_CHECK(with_parent > 20);
+
+    // The outer rings are no holes, they have no parent, and their
+    // children are the holes
+    std::size_t children = 0;
+    for (std::size_t j = 0; j < outer_count; j++)
+    {
+        properties const& outer = ring_map[bg::ring_identifier(2, j, -1)];
+        BOOST_CHECK_EQUAL(outer.parent.source_index, -1);
+        children += outer.children.size();
+    }
+    BOOST_CHECK_EQUAL(children, with_parent);
+}
+
+
+int test_main(int, char* [])
+{
+    test_many_holes<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
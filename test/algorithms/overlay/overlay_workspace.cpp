@@ -0,0 +1,106 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <algorithms/overlay/overlay_cases.hpp>
+#include <algorithms/overlay/multi_overlay_cases.hpp>
+
+
+// Verifies that overlay operations using a workspace give the same results
+// as without, also if the same workspace is reused for several calls
+template <typename Geometry1, typename Geometry2, typename MultiPolygon, typename Workspace>
+void test_one(std::string const& caseid, std::string const& wkt1,
+              std::string const& wkt2, Workspace& workspace)
+{
+    Geometry1 g1;
+    bg::read_wkt(wkt1, g1);
+    bg::correct(g1);
+
+    Geometry2 g2;
+    bg::read_wkt(wkt2, g2);
+    bg::correct(g2);
+
+    // Two rounds, the second one reuses the capacity of the first
+    for (int i = 0; i < 2; i++)
+    {
+        MultiPolygon expected, result;
+
+        bg::intersection(g1, g2, expected);
+        BOOST_CHECK(bg::intersection(g1, g2, result, workspace));
+        BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+            caseid << " intersection, count: " << result.size()
+                   << " expected: " << expected.size());
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+        expected.clear();
+        result.clear();
+        bg::union_(g1, g2, expected);
+        bg::union_(g1, g2, result, workspace);
+        BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+            caseid << " union, count: " << result.size()
+                   << " expected: " << expected.size());
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+        expected.clear();
+        result.clear();
+        bg::difference(g1, g2, expected);
+        bg::difference(g1, g2, result, workspace);
+        BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+            caseid << " difference, count: " << result.size()
+                   << " expected: " << expected.size());
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+
+    // One workspace for all cases, of different geometry types
+    bg::overlay_workspace<multi_polygon> workspace;
+
+    test_one<polygon, polygon, multi_polygon>("case_1",
+        case_1[0], case_1[1], workspace);
+    test_one<polygon, polygon, multi_polygon>("case_2",
+        case_2[0], case_2[1], workspace);
+    test_one<polygon, polygon, multi_polygon>("case_many_situations",
+        case_many_situations[0], case_many_situations[1], workspace);
+    test_one<multi_polygon, multi_polygon, multi_polygon>("case_multi_simplex",
+        case_multi_simplex[0], case_multi_simplex[1], workspace);
+    test_one<multi_polygon, multi_polygon, multi_polygon>("case_multi_2",
+        case_multi_2[0], case_multi_2[1], workspace);
+    test_one<polygon, multi_polygon, multi_polygon>("case_mixed",
+        case_1[0], case_multi_simplex[1], workspace);
+
+    // With a box, the intersection is calculated by clipping
+    test_one<polygon, box, multi_polygon>("case_box",
+        case_1[0], "BOX(1 1,4 4)", workspace);
+    test_one<box, polygon, multi_polygon>("case_box_reversed",
+        "BOX(1 1,4 4)", case_1[0], workspace);
+
+    // One of the inputs empty
+    test_one<polygon, multi_polygon, multi_polygon>("empty",
+        case_1[0], "MULTIPOLYGON()", workspace);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
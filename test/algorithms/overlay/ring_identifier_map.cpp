@@ -0,0 +1,90 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <map>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
+
+
+typedef bg::detail::overlay::ring_identifier_map<int> map_type;
+
+void test_insert_and_find()
+{
+    map_type map;
+    BOOST_CHECK(map.empty());
+
+    map[bg::ring_identifier(0, -1, -1)] = 1;
+    map[bg::ring_identifier(0, -1, 5)] = 2;
+    map[bg::ring_identifier(1, 3, -1)] = 3;
+    map[bg::ring_identifier(2, 0, -1)] = 4;
+
+    BOOST_CHECK_EQUAL(map.size(), 4u);
+    BOOST_CHECK_EQUAL(map[bg::ring_identifier(0, -1, 5)], 2);
+    BOOST_CHECK_EQUAL(map.count(bg::ring_identifier(1, 3, -1)), 1u);
+    BOOST_CHECK_EQUAL(map.count(bg::ring_identifier(1, 2, -1)), 0u);
+    BOOST_CHECK_EQUAL(map.count(bg::ring_identifier(0, -1, 4)), 0u);
+    BOOST_CHECK_EQUAL(map.count(bg::ring_identifier(3, 0, -1)), 0u);
+    BOOST_CHECK(map.find(bg::ring_identifier(1, 4, 0)) == map.end());
+    BOOST_CHECK_EQUAL(map.find(bg::ring_identifier(2, 0, -1))->second, 4);
+
+    // Growing a row keeps the existing values
+    map[bg::ring_identifier(0, -1, 100)] = 5;
+    BOOST_CHECK_EQUAL(map[bg::ring_identifier(0, -1, -1)], 1);
+    BOOST_CHECK_EQUAL(map[bg::ring_identifier(0, -1, 5)], 2);
+    BOOST_CHECK_EQUAL(map[bg::ring_identifier(0, -1, 100)], 5);
+    BOOST_CHECK_EQUAL(map.size(), 5u);
+
+    map.clear();
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK_EQUAL(map.count(bg::ring_identifier(0, -1, 5)), 0u);
+}
+
+void test_order()
+{
+    // Iteration should be in the same order as for std::map, also if keys
+    // are inserted in a random order
+    map_type map;
+    std::map<bg::ring_identifier, int> reference;
+
+    int const sources[] = { 1, 0, 2, 0, 1, 0, 2 };
+    int const multis[] = { 3, 2, 0, -1, 0, 2, 5 };
+    int const rings[] = { 0, -1, -1, 4, 2, 1, -1 };
+
+    for (int i = 0; i < 7; i++)
+    {
+        bg::ring_identifier const id(sources[i], multis[i], rings[i]);
+        map[id] = i;
+        reference[id] = i;
+    }
+
+    BOOST_CHECK_EQUAL(map.size(), reference.size());
+
+    std::map<bg::ring_identifier, int>::const_iterator rit = reference.begin();
+    for (map_type::const_iterator it = map.begin();
+         it != map.end() && rit != reference.end(); ++it, ++rit)
+    {
+        BOOST_CHECK(it->first == rit->first);
+        BOOST_CHECK_EQUAL(it->second, rit->second);
+    }
+
+    // After sorting, lookup should still be correct
+    for (rit = reference.begin(); rit != reference.end(); ++rit)
+    {
+        BOOST_CHECK_EQUAL(map.find(rit->first)->second, rit->second);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_insert_and_find();
+    test_order();
+    return 0;
+}
@@ -254,8 +254,23 @@ void test_all()
     TEST_UNION(case_recursive_boxes_23, 3);
 }
 
+void test_handled_indices()
+{
+    // More indices than fit in the fixed capacity buffer
+    bg::detail::overlay::sort_by_side::handled_indices handled;
+    for (int i = 0; i < 40; i++)
+    {
+        BOOST_CHECK(handled.insert(i * 7 % 40));
+    }
+    for (int i = 0; i < 40; i++)
+    {
+        BOOST_CHECK(! handled.insert(i));
+    }
+}
+
 int test_main(int, char* [])
 {
+    test_handled_indices();
     test_all<double>();
     return 0;
  }
@@ -171,6 +171,22 @@ void check_geometry(Geometry1 const& geometry1,
             BOOST_CHECK(result == result3);
         }
 
+        {
+            // mask containing only 'T' and '*', the result may be known
+            // before all turns are analysed
+            std::string expected_decided = expected1;
+            BOOST_FOREACH(char & c, expected_decided)
+            {
+                c = ( c == 'T' || ( c >= '0' && c <= '9' ) ) ? 'T' : '*';
+            }
+
+            bool result = bg::relate(geometry1, geometry2, bg::de9im::mask(expected_decided));
+            BOOST_CHECK_MESSAGE(result,
+                "relate: " << wkt1
+                << " and " << wkt2
+                << " -> Expected: " << expected_decided);
+        }
+
         if ( BOOST_GEOMETRY_CONDITION((
                 bg::detail::relate::interruption_enabled<Geometry1, Geometry2>::value )) )
         {
@@ -18,11 +18,14 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <climits>
+#include <cmath>
 #include <iostream>
 #include <string>
 
 #include <boost/config.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/register/linestring.hpp>
@@ -411,6 +414,162 @@ void test_areal_clip()
     test_one<Polygon, Box, Polygon>("clip_poly7", "Box(0 0, 3 3)",
         "POLYGON((2 2, 1 4, 2 4, 3 3, 2 2))",
         1, 4, 0.75);
+
+    // Clipping of polygons with edges on, or vertices on, the box border
+    test_one<Polygon, Box, Polygon>("clip_along_inside", "Box(0 0,10 10)",
+        "POLYGON((0 -5,0 15,20 15,20 -5,0 -5))",
+        1, 5, 100.0);
+    test_one<Polygon, Box, Polygon>("clip_along_outside", "Box(0 0,10 10)",
+        "POLYGON((-5 2,-5 8,0 8,0 2,-5 2))",
+        0, 0, 0.0);
+    test_one<Polygon, Box, Polygon>("clip_vertices_on_border", "Box(0 0,10 10)",
+        "POLYGON((0 5,5 10,10 5,5 0,0 5))",
+        1, 5, 50.0);
+    test_one<Polygon, Box, Polygon>("clip_corners_on_edges", "Box(0 0,10 10)",
+        "POLYGON((-5 5,5 15,15 5,5 -5,-5 5))",
+        1, 5, 100.0);
+    test_one<Polygon, Box, Polygon>("clip_two_pieces", "Box(0 0,10 10)",
+        "POLYGON((1 -1,1 5,3 5,3 -1,5 -1,5 5,7 5,7 -1,8 -1,8 -2,1 -2,1 -1))",
+        2, 10, 20.0);
+    test_one<Polygon, Box, Polygon>("clip_hole_crossing", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5),(-2 2,8 2,8 8,-2 8,-2 2))",
+        1, 9, 52.0);
+    test_one<Polygon, Box, Polygon>("clip_hole_on_border", "Box(0 0,10 10)",
+        "POLYGON((-2 -2,-2 12,12 12,12 -2,-2 -2),(8 3,10 5,8 7,8 3))",
+        1, 9, 96.0);
+    test_one<Polygon, Box, Polygon>("clip_box_in_hole", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5),(-2 -2,12 -2,12 12,-2 12,-2 -2))",
+        0, 0, 0.0);
+
+    // Island in a lake in an island: the hole of the inner island should
+    // be assigned to the inner island
+    typedef bg::model::multi_polygon<Polygon> multi_polygon;
+    test_one<Polygon, Box, multi_polygon>("clip_nested_islands", "Box(10 10,90 90)",
+        "MULTIPOLYGON(((0 0,0 100,100 100,100 0,0 0),(20 20,80 20,80 80,20 80,20 20)),"
+        "((30 30,30 70,70 70,70 30,30 30),(40 40,60 40,60 60,40 60,40 40)))",
+        2, 20, 4000.0);
+
+    // Pieces meeting on the border should not leave a spike or a
+    // collinear vertex on the border
+    test_one<Polygon, Box, Polygon>("clip_spike_on_border", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 5,5 5,0 2,0 -5,-5 -5))",
+        1, 4, 7.5);
+    test_one<Polygon, Box, Polygon>("clip_run_along_border", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 5,0 5,0 2,5 2,5 -5,-5 -5))",
+        1, 5, 10.0);
+
+    // A reflex vertex touching the border splits the result
+    test_one<Polygon, Box, Polygon>("clip_reflex_on_border", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 10,5 0,15 10,15 -5,-5 -5))",
+        2, 8, 25.0);
+
+    // A hole inside the box, touching two sides of it, splits the result
+    test_one<Polygon, Box, Polygon>("clip_hole_touching_sides", "Box(0 0,10 10)",
+        "POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5),(0 5,5 8,10 5,5 2,0 5))",
+        2, 12, 70.0);
+}
+
+// Compares clipping with the overlay of the polygon with the box as
+// polygon, for random star shaped polygons with a hole, on a coarse
+// integer grid such that many vertices are located on the border
+template <typename Polygon, typename Box>
+void test_areal_clip_random()
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef bg::model::linestring<point_type> linestring;
+    typedef bg::model::multi_polygon<Polygon> multi_polygon;
+
+    boost::random::mt19937 generator(12345);
+    boost::random::uniform_int_distribution<int> coordinate(0, 20);
+    boost::random::uniform_int_distribution<int> vertex_count(3, 12);
+
+    double const pi = 3.14159265358979323846;
+    for (int i = 0; i < 10000; i++)
+    {
+        double const cx = coordinate(generator);
+        double const cy = coordinate(generator);
+
+        Polygon polygon;
+        linestring exterior, interior;
+        int const n = vertex_count(generator);
+        for (int j = 0; j < n; j++)
+        {
+            double const angle = -2.0 * pi * (j + coordinate(generator) / 40.0) / n;
+            double const radius = 1.0 + coordinate(generator) / 2.0;
+            bg::append(exterior, point_type(
+                std::floor(cx + radius * std::cos(angle) + 0.5),
+                std::floor(cy + radius * std::sin(angle) + 0.5)));
+        }
+        point_type const first_exterior = exterior.front();
+        bg::append(exterior, first_exterior);
+        bg::assign_points(bg::exterior_ring(polygon), exterior);
+
+        if (coordinate(generator) % 2 == 0)
+        {
+            int const h = vertex_count(generator);
+            for (int j = 0; j < h; j++)
+            {
+                double const angle = 2.0 * pi * (j + coordinate(generator) / 40.0) / h;
+                double const radius = coordinate(generator) / 20.0;
+                bg::append(interior, point_type(
+                    std::floor(cx + radius * std::cos(angle) + 0.5),
+                    std::floor(cy + radius * std::sin(angle) + 0.5)));
+            }
+            point_type const first_interior = interior.front();
+            bg::append(interior, first_interior);
+            bg::interior_rings(polygon).resize(1);
+            bg::assign_points(bg::interior_rings(polygon).front(), interior);
+        }
+        bg::correct(polygon);
+
+        // The overlay does not handle holes touching the exterior ring
+        if (! bg::is_valid(polygon)
+            || (! bg::is_empty(interior) && bg::intersects(exterior, interior)))
+        {
+            continue;
+        }
+
+        int const x1 = coordinate(generator), y1 = coordinate(generator);
+        int const x2 = coordinate(generator), y2 = coordinate(generator);
+        if (x1 >= x2 || y1 >= y2)
+        {
+            continue;
+        }
+        Box box(point_type(x1, y1), point_type(x2, y2));
+        Polygon box_polygon;
+        bg::convert(box, box_polygon);
+
+        multi_polygon clipped, expected;
+        bg::intersection(polygon, box, clipped);
+        bg::intersection(polygon, box_polygon, expected);
+
+        std::string message;
+        BOOST_CHECK_MESSAGE(bg::is_valid(clipped, message),
+            "clip_random: " << bg::wkt(polygon) << " " << bg::wkt(box)
+            << " not valid " << message);
+        double const area = bg::area(expected);
+        BOOST_CHECK_MESSAGE(clipped.size() == expected.size()
+                && std::fabs(bg::area(clipped) - area) < 1.0e-5 * (1.0 + area),
+            "clip_random: " << bg::wkt(polygon) << " " << bg::wkt(box)
+            << " clipped: " << bg::wkt(clipped)
+            << " expected: " << bg::wkt(expected));
+    }
+}
+
+
+template <typename Point>
+void test_areal_clip_integer()
+{
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::box<Point> box;
+
+    // The center of the box must not be truncated onto its border
+    test_one<polygon, box, polygon>("clip_int_ring_contains_box", "Box(0 0,1 1)",
+        "POLYGON((0 0,0 2,2 2,2 0,0 0))",
+        1, 5, 1.0);
+    test_one<polygon, box, polygon>("clip_int_ring_outside", "Box(0 0,1 1)",
+        "POLYGON((1 0,1 1,2 1,2 0,1 0))",
+        0, 0, 0.0);
 }
 
 
@@ -647,8 +806,10 @@ void test_all()
 #endif
 
     test_areal_clip<polygon, box>();
+    test_areal_clip_random<polygon, box>();
 #if ! defined(BOOST_GEOMETRY_TEST_ONLY_ONE_TYPE)
     test_areal_clip<polygon_ccw, box>();
+    test_areal_clip_random<polygon_ccw, box>();
 #endif
 
 #if defined(TEST_FAIL_DIFFERENT_ORIENTATIONS)
@@ -855,6 +1016,8 @@ int test_main(int, char* [])
 
     test_boxes_nd<double>();
 
+    test_areal_clip_integer<bg::model::d2::point_xy<int> >();
+
 #ifdef BOOST_GEOMETRY_TEST_INCLUDE_FAILING_TESTS
     // ticket #10868 still fails for 32-bit integers
     test_ticket_10868<int32_t>("MULTIPOLYGON(((33520458 6878575,33480192 14931538,31446819 18947953,30772384 19615678,30101303 19612322,30114725 16928001,33520458 6878575)))");
@@ -12,6 +12,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <iterator>
 
 
@@ -191,6 +192,33 @@ void test_zigzag()
 }
 
 
+// A spiral, of which each vertex is split off separately, with collinear
+// points in between which should be removed
+template <typename P>
+void test_spiral()
+{
+    bg::model::linestring<P> spiral;
+    bg::model::linestring<P> expected;
+    for (int i = 0; i < 5000; i++)
+    {
+        P const p(i * std::cos(i * 1.0), i * std::sin(i * 1.0));
+        if (i > 0)
+        {
+            P const& previous = bg::range::back(expected);
+            spiral.push_back(P((bg::get<0>(previous) + bg::get<0>(p)) / 2.0,
+                               (bg::get<1>(previous) + bg::get<1>(p)) / 2.0));
+        }
+        spiral.push_back(p);
+        expected.push_back(p);
+    }
+
+    bg::model::linestring<P> simplified;
+    bg::simplify(spiral, simplified, 0.1);
+    BOOST_CHECK_EQUAL(boost::size(simplified), boost::size(expected));
+    BOOST_CHECK(bg::equals(simplified, expected));
+}
+
+
 template <typename P>
 void test_3d()
 {
@@ -226,6 +254,8 @@ int test_main(int, char* [])
 
     test_zigzag<bg::model::d2::point_xy<double> >();
 
+    test_spiral<bg::model::d2::point_xy<double> >();
+
 #if defined(HAVE_TTMATH)
     test_all<bg::model::d2::point_xy<ttmath_big> >();
     test_spherical<bg::model::point<ttmath_big, 2, bg::cs::spherical_equatorial<bg::degree> > >();
@@ -0,0 +1,146 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the performance of is_valid for a polygon with many holes.
+// The holes are either separate squares, or zigzag rows of squares each
+// touching its neighbours at a corner (generating many turns)
+
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Ring>
+void make_square(Ring& ring, double x, double y, double size, bool counter_clockwise)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    bg::append(ring, point_type(x, y));
+    if (counter_clockwise)
+    {
+        bg::append(ring, point_type(x + size, y));
+        bg::append(ring, point_type(x + size, y + size));
+        bg::append(ring, point_type(x, y + size));
+    }
+    else
+    {
+        bg::append(ring, point_type(x, y + size));
+        bg::append(ring, point_type(x + size, y + size));
+        bg::append(ring, point_type(x + size, y));
+    }
+    bg::append(ring, point_type(x, y));
+}
+
+template <typename Polygon>
+void make_polygon(Polygon& polygon, int count, bool touching, bool nested)
+{
+    make_square(bg::exterior_ring(polygon), -10.0, -10.0, count * 10.0 + 20.0, false);
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            if (touching)
+            {
+                // Zigzag rows, in every third row
+                if (j % 3 != i % 2)
+                {
+                    continue;
+                }
+                polygon.inners().resize(polygon.inners().size() + 1);
+                make_square(polygon.inners().back(), i * 10.0, j * 10.0, 10.0, true);
+            }
+            else
+            {
+                polygon.inners().resize(polygon.inners().size() + 1);
+                make_square(polygon.inners().back(), i * 10.0 + 1.0, j * 10.0 + 1.0, 8.0, true);
+            }
+        }
+    }
+
+    if (nested)
+    {
+        // Add a hole in the last hole
+        polygon.inners().resize(polygon.inners().size() + 1);
+        make_square(polygon.inners().back(), (count - 1) * 10.0 + 3.0,
+                    (count - 1) * 10.0 + 3.0, 4.0, true);
+    }
+}
+
+template <typename T>
+void test_all(int count, bool touching, bool nested)
+{
+    typedef bg::model::d2::point_xy<T> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    polygon_type polygon;
+    make_polygon(polygon, count, touching, nested);
+
+    boost::timer t;
+    std::string message;
+    bool const valid = bg::is_valid(polygon, message);
+
+    std::cout
+        << "holes: " << bg::num_interior_rings(polygon)
+        << (touching ? " touching" : "")
+        << (nested ? " nested" : "")
+        << " valid: " << std::boolalpha << valid
+        << " (" << message << ")"
+        << " time: " << t.elapsed() << " s"
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== many_holes ===\nAllowed options");
+
+        int count = 100;
+        bool touching = false;
+        bool nested = false;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(100), "Number of holes in x and y direction")
+            ("touching", po::value<bool>(&touching)->default_value(false), "Holes touch each other in zigzag rows")
+            ("nested", po::value<bool>(&nested)->default_value(false), "Add a nested hole (invalid)")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_all<double>(count, touching, nested);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the performance of finding overlapping sections of one geometry
+// (as done for self-turns, compared with partition), and of is_simple, for
+// long linestrings:
+// lawnmower tracks (many parallel rows, with many sections crossing any
+// line perpendicular to the rows) and a random walk
+
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_boxes.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Linestring>
+void make_lawnmower(Linestring& track, int rows, int length)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    for (int row = 0; row < rows; row++)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            bg::append(track, point_type(row % 2 == 0 ? i : length - 1 - i,
+                                         row * 2.0 + (i % 2) * 0.5));
+        }
+    }
+}
+
+template <typename Linestring>
+void make_random_walk(Linestring& track, int count)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    boost::mt19937 generator(12345);
+    boost::random::uniform_int_distribution<> step(-1, 1);
+
+    int x = 0, y = 0;
+    for (int i = 0; i < count; i++)
+    {
+        bg::append(track, point_type(x, y));
+        x += step(generator);
+        y += step(generator);
+    }
+}
+
+struct count_overlapping_visitor
+{
+    std::size_t count;
+    count_overlapping_visitor() : count(0) {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! bg::detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box))
+        {
+            count++;
+        }
+        return true;
+    }
+};
+
+template <typename Linestring>
+void report(std::string const& name, Linestring const& track)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 1> sections_type;
+    typedef boost::mpl::vector_c<std::size_t, 0> dimensions;
+
+    sections_type sections;
+    bg::sectionalize<false, dimensions>(track, bg::detail::no_rescale_policy(),
+            sections, 0, bg::detail::sectionalize::default_max_count<point_type>());
+
+    std::cout << name << " points: " << bg::num_points(track)
+        << " sections: " << sections.size();
+
+    {
+        boost::timer t;
+        count_overlapping_visitor visitor;
+        bg::detail::section::visit_sections
+            <
+                bg::cartesian_tag
+            >::apply(sections, visitor);
+        std::cout << " overlapping: " << visitor.count
+            << " (" << t.elapsed() << " s)";
+    }
+
+    {
+        // For comparison
+        boost::timer t;
+        count_overlapping_visitor visitor;
+        bg::detail::section::visit_sections
+            <
+                void
+            >::apply(sections, visitor);
+        std::cout << " partition: " << visitor.count
+            << " (" << t.elapsed() << " s)";
+    }
+
+    {
+        boost::timer t;
+        bool const simple = bg::is_simple(track);
+        std::cout << " simple: " << std::boolalpha << simple
+            << " (" << t.elapsed() << " s)";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== self_turns_tracks ===\nAllowed options");
+
+        int rows = 200;
+        int length = 5000;
+        int square = 1000;
+        int walk = 100000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("rows", po::value<int>(&rows)->default_value(200), "Number of rows of the lawnmower track")
+            ("length", po::value<int>(&length)->default_value(5000), "Number of points of each row of the lawnmower track")
+            ("square", po::value<int>(&square)->default_value(1000), "Number of rows and points per row of the square lawnmower track")
+            ("walk", po::value<int>(&walk)->default_value(100000), "Number of points of the random walk")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        typedef bg::model::d2::point_xy<double> point_type;
+        typedef bg::model::linestring<point_type> linestring_type;
+
+        linestring_type lawnmower, square_lawnmower, random_walk;
+        make_lawnmower(lawnmower, rows, length);
+        make_lawnmower(square_lawnmower, square, square);
+        make_random_walk(random_walk, walk);
+
+        report("lawnmower", lawnmower);
+        report("square", square_lawnmower);
+        report("walk", random_walk);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares clipping a polygon by boxes (intersection of areal and box)
+// with the generic overlay, on performance and on area, for a star shaped
+// polygon (with a hole) clipped by a grid of tiles
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Polygon>
+void make_star(Polygon& polygon, int point_count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    double const pi = 3.14159265358979323846;
+    for (int i = 0; i < point_count; i++)
+    {
+        double const angle = -2.0 * pi * i / point_count;
+        double const radius = i % 2 == 0 ? 100.0 : 60.0;
+        bg::append(polygon, point_type(radius * std::cos(angle),
+                                       radius * std::sin(angle)));
+    }
+    bg::append(polygon, bg::exterior_ring(polygon).front());
+
+    polygon.inners().resize(1);
+    for (int i = 0; i <= point_count; i++)
+    {
+        double const angle = 2.0 * pi * i / point_count;
+        bg::append(polygon.inners().front(), point_type(20.0 * std::cos(angle),
+                                                        20.0 * std::sin(angle)));
+    }
+}
+
+template <typename Polygon, typename Box>
+double clip_generic(Polygon const& polygon, Box const& box)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::rescale_policy_type<point_type>::type rescale_policy_type;
+    typedef bg::intersection_strategies
+        <
+            bg::cartesian_tag, Polygon, Box, point_type, rescale_policy_type
+        > strategy;
+
+    rescale_policy_type robust_policy
+        = bg::get_rescale_policy<rescale_policy_type>(polygon, box);
+
+    bg::model::multi_polygon<Polygon> result;
+    bg::detail::overlay::overlay
+        <
+            Polygon, Box, false, false, false, Polygon, bg::overlay_intersection
+        >::apply(polygon, box, robust_policy, std::back_inserter(result), strategy());
+    return bg::area(result);
+}
+
+template <typename Polygon, typename Box>
+double clip_fast(Polygon const& polygon, Box const& box)
+{
+    bg::model::multi_polygon<Polygon> result;
+    bg::intersection(polygon, box, result);
+    return bg::area(result);
+}
+
+template <typename T>
+void test_all(int point_count, int tile_count)
+{
+    typedef bg::model::d2::point_xy<T> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::box<point_type> box_type;
+
+    polygon_type polygon;
+    make_star(polygon, point_count);
+
+    std::vector<box_type> tiles;
+    double const size = 220.0 / tile_count;
+    for (int i = 0; i < tile_count; i++)
+    {
+        for (int j = 0; j < tile_count; j++)
+        {
+            double const x = -110.0 + i * size;
+            double const y = -110.0 + j * size;
+            tiles.push_back(box_type(point_type(x, y),
+                                     point_type(x + size, y + size)));
+        }
+    }
+
+    double area_generic = 0, area_fast = 0;
+
+    boost::timer t;
+    for (std::size_t i = 0; i < tiles.size(); i++)
+    {
+        area_generic += clip_generic(polygon, tiles[i]);
+    }
+    double const time_generic = t.elapsed();
+
+    t.restart();
+    for (std::size_t i = 0; i < tiles.size(); i++)
+    {
+        area_fast += clip_fast(polygon, tiles[i]);
+    }
+    double const time_fast = t.elapsed();
+
+    std::cout
+        << "points: " << point_count
+        << " tiles: " << tiles.size()
+        << " area: " << bg::area(polygon)
+        << " generic: " << area_generic << " (" << time_generic << " s)"
+        << " clip: " << area_fast << " (" << time_fast << " s)"
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== clip_polygon_by_box ===\nAllowed options");
+
+        int point_count = 1000;
+        int tile_count = 16;
+
+        description.add_options()
+            ("help", "Help message")
+            ("points", po::value<int>(&point_count)->default_value(1000), "Number of points of the star")
+            ("tiles", po::value<int>(&tile_count)->default_value(16), "Number of tiles in x and y direction")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_all<double>(point_count, tile_count);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
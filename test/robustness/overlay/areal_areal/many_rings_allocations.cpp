@@ -0,0 +1,190 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Counts heap allocations of the ring bookkeeping in overlay, for inputs
+// having many rings, comparing node based maps with the flat
+// ring_identifier_map, and reports the allocations of a complete union
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+#include <boost/geometry/algorithms/detail/overlay/ring_identifier_map.hpp>
+
+
+static std::size_t allocation_count = 0;
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == 0)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    std::free(p);
+}
+
+namespace bg = boost::geometry;
+
+
+// Creates a multi-polygon of count * count squares, each having one hole
+template <typename MultiPolygon>
+void make_squares(MultiPolygon& mp, int count, double offset)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = offset + i * 10.0;
+            double const y = offset + j * 10.0;
+
+            polygon_type poly;
+            bg::append(poly, point_type(x, y));
+            bg::append(poly, point_type(x, y + 8.0));
+            bg::append(poly, point_type(x + 8.0, y + 8.0));
+            bg::append(poly, point_type(x + 8.0, y));
+            bg::append(poly, point_type(x, y));
+
+            poly.inners().resize(1);
+            bg::append(poly.inners().front(), point_type(x + 2.0, y + 2.0));
+            bg::append(poly.inners().front(), point_type(x + 6.0, y + 2.0));
+            bg::append(poly.inners().front(), point_type(x + 6.0, y + 6.0));
+            bg::append(poly.inners().front(), point_type(x + 2.0, y + 6.0));
+            bg::append(poly.inners().front(), point_type(x + 2.0, y + 2.0));
+            mp.push_back(poly);
+        }
+    }
+}
+
+template <typename TurnInfoMap, typename PropertyMap, typename MultiPolygon, typename Turns>
+std::size_t count_bookkeeping(MultiPolygon const& mp1, MultiPolygon const& mp2,
+                              Turns const& turns)
+{
+    std::size_t const before = allocation_count;
+
+    TurnInfoMap turn_info_per_ring;
+    bg::detail::overlay::get_ring_turn_info(turn_info_per_ring, turns);
+
+    PropertyMap selected_ring_properties;
+    bg::detail::overlay::select_rings<bg::overlay_union>(mp1, mp2,
+            turn_info_per_ring, selected_ring_properties);
+
+    return allocation_count - before;
+}
+
+template <typename T>
+void test_all(int count)
+{
+    typedef bg::model::d2::point_xy<T> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef bg::detail::overlay::ring_properties<point_type> properties;
+    typedef bg::detail::overlay::ring_turn_info ring_turn_info;
+
+    multi_polygon_type mp1, mp2;
+    make_squares(mp1, count, 0.0);
+    make_squares(mp2, count, 5.0);
+
+    typedef typename bg::rescale_policy_type<point_type>::type rescale_policy_type;
+    rescale_policy_type robust_policy
+            = bg::get_rescale_policy<rescale_policy_type>(mp1, mp2);
+
+    typedef bg::detail::overlay::traversal_turn_info
+        <
+            point_type,
+            typename bg::segment_ratio_type<point_type, rescale_policy_type>::type
+        > turn_info;
+    std::deque<turn_info> turns;
+    bg::detail::get_turns::no_interrupt_policy policy;
+    bg::get_turns<false, false, bg::detail::overlay::assign_null_policy>
+            (mp1, mp2, robust_policy, turns, policy);
+
+    std::size_t const node_based = count_bookkeeping
+        <
+            std::map<bg::ring_identifier, ring_turn_info>,
+            std::map<bg::ring_identifier, properties>
+        >(mp1, mp2, turns);
+
+    std::size_t const flat = count_bookkeeping
+        <
+            bg::detail::overlay::ring_identifier_map<ring_turn_info>,
+            bg::detail::overlay::ring_identifier_map<properties>
+        >(mp1, mp2, turns);
+
+    multi_polygon_type result;
+    std::size_t const before = allocation_count;
+    boost::timer t;
+    bg::union_(mp1, mp2, result);
+    double const elapsed = t.elapsed();
+
+    std::cout
+        << "rings: " << 4 * count * count
+        << " turns: " << turns.size()
+        << " bookkeeping allocations std::map: " << node_based
+        << " flat: " << flat
+        << " union allocations: " << allocation_count - before
+        << " time: " << elapsed
+        << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== many_rings_allocations ===\nAllowed options");
+
+        int count = 100;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(100), "Number of squares in x and y direction")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_all<double>(count);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the performance of relational predicates, which stop generating
+// turns as soon as their result is known, with calculating the complete
+// DE-9IM matrix, for two large crossing star shaped polygons
+
+#include <cmath>
+#include <iostream>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Polygon>
+void make_star(Polygon& polygon, int point_count, double offset, double radius)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    double const pi = 3.14159265358979323846;
+    for (int i = 0; i < point_count; i++)
+    {
+        double const angle = -2.0 * pi * i / point_count;
+        double const r = i % 2 == 0 ? 100.0 : radius;
+        bg::append(polygon, point_type(offset + r * std::cos(angle),
+                                       r * std::sin(angle)));
+    }
+    bg::append(polygon, bg::exterior_ring(polygon).front());
+}
+
+template <typename Predicate, typename Polygon>
+void report(std::string const& name, Predicate const& predicate,
+            Polygon const& p, Polygon const& q)
+{
+    boost::timer t;
+    bool const result = predicate(p, q);
+    std::cout << " " << name << ": " << std::boolalpha << result
+        << " (" << t.elapsed() << " s)";
+}
+
+struct relation_predicate
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const
+    {
+        // Calculates the complete matrix
+        return bg::relation(g1, g2).str()[0] != 'F';
+    }
+};
+
+struct relate_predicate
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const
+    {
+        return bg::relate(g1, g2, bg::de9im::mask("T********"));
+    }
+};
+
+struct intersects_predicate
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const
+    {
+        return bg::intersects(g1, g2);
+    }
+};
+
+struct touches_predicate
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const
+    {
+        return bg::touches(g1, g2);
+    }
+};
+
+struct overlaps_predicate
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const
+    {
+        return bg::overlaps(g1, g2);
+    }
+};
+
+template <typename T>
+void test_all(int point_count)
+{
+    typedef bg::model::d2::point_xy<T> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    polygon_type p, q;
+    make_star(p, point_count, 0.0, 60.0);
+    make_star(q, point_count + 1, 50.0, 61.0);
+
+    std::cout << "points: " << point_count;
+    report("relation", relation_predicate(), p, q);
+    report("relate", relate_predicate(), p, q);
+    report("intersects", intersects_predicate(), p, q);
+    report("touches", touches_predicate(), p, q);
+    report("overlaps", overlaps_predicate(), p, q);
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== relate_early_exit ===\nAllowed options");
+
+        int point_count = 20000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("points", po::value<int>(&point_count)->default_value(20000), "Number of points of the stars")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_all<double>(point_count);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the performance of finding overlapping sections, and of
+// relational predicates and intersection, for a large star shaped polygon
+// (with about one section per segment) and a small square (four sections)
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_boxes.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Polygon>
+void make_star(Polygon& polygon, int point_count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    double const pi = 3.14159265358979323846;
+    for (int i = 0; i < point_count; i++)
+    {
+        double const angle = -2.0 * pi * i / point_count;
+        double const r = i % 2 == 0 ? 100.0 : 60.0;
+        bg::append(polygon, point_type(r * std::cos(angle),
+                                       r * std::sin(angle)));
+    }
+    bg::append(polygon, bg::exterior_ring(polygon).front());
+}
+
+struct count_overlapping_visitor
+{
+    std::size_t count;
+    count_overlapping_visitor() : count(0) {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! bg::detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box))
+        {
+            count++;
+        }
+        return true;
+    }
+};
+
+template <typename Polygon>
+void report_sections(Polygon const& large, Polygon const& small)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+    std::size_t const max_count
+        = bg::detail::sectionalize::default_max_count<point_type>();
+
+    sections_type sections1, sections2;
+    bg::sectionalize<false, dimensions>(large, bg::detail::no_rescale_policy(),
+            sections1, 0, max_count);
+    bg::sectionalize<false, dimensions>(small, bg::detail::no_rescale_policy(),
+            sections2, 1, max_count);
+
+    std::cout << "sections: " << sections1.size()
+        << " and " << sections2.size();
+
+    {
+        boost::timer t;
+        count_overlapping_visitor visitor;
+        bg::detail::section::visit_sections
+            <
+                bg::cartesian_tag
+            >::apply(sections1, sections2, visitor);
+        std::cout << " overlapping: " << visitor.count
+            << " (" << t.elapsed() << " s)";
+    }
+
+    {
+        boost::timer t;
+        count_overlapping_visitor visitor;
+        bg::detail::section::visit_sections
+            <
+                bg::cartesian_tag
+            >::apply(sections2, sections1, visitor);
+        std::cout << " reversed: " << visitor.count
+            << " (" << t.elapsed() << " s)";
+    }
+    std::cout << std::endl;
+}
+
+template <typename Polygon>
+void report(Polygon const& large, Polygon const& small)
+{
+    {
+        boost::timer t;
+        bool const result = bg::intersects(large, small);
+        std::cout << "intersects: " << std::boolalpha << result
+            << " (" << t.elapsed() << " s)";
+    }
+    {
+        boost::timer t;
+        bool const result = bg::relate(large, small,
+                                       bg::de9im::mask("T********"));
+        std::cout << " relate: " << std::boolalpha << result
+            << " (" << t.elapsed() << " s)";
+    }
+    {
+        boost::timer t;
+        bg::model::multi_polygon<Polygon> result;
+        bg::intersection(large, small, result);
+        std::cout << " intersection: " << bg::area(result)
+            << " (" << t.elapsed() << " s)";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== small_against_large ===\nAllowed options");
+
+        int point_count = 2000000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("points", po::value<int>(&point_count)->default_value(2000000), "Number of points of the star")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        typedef bg::model::d2::point_xy<double> point_type;
+        typedef bg::model::polygon<point_type> polygon_type;
+
+        polygon_type large, small;
+        make_star(large, point_count);
+
+        // A square over the tip of the star at angle 0
+        bg::read_wkt("POLYGON((90 -5,90 5,110 5,110 -5,90 -5))", small);
+
+        std::cout << "points: " << point_count << std::endl;
+        report_sections(large, small);
+        report(large, small);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
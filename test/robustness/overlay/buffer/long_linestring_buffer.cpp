@@ -0,0 +1,115 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Performance Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Buffers long linestrings with round joins, generating many pieces
+// (one or more per segment and per join), and reports the time, the
+// area and the number of output points. The linestrings meander and often
+// return close to themselves, such that many pieces overlap each other.
+// Round joins and ends are created with a fixed number of points per
+// circle, and with a number of points calculated from a maximum deviation.
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/timer.hpp>
+
+
+namespace bg = boost::geometry;
+
+template <typename Linestring>
+Linestring make_meander(int n)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    Linestring result;
+    double x = 0.0;
+    double y = 0.0;
+    double angle = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        result.push_back(point_type(x, y));
+
+        // Turn left and right, in an irregular way
+        angle += 0.9 * std::sin(i * 0.37) + 0.4 * std::cos(i * 0.011);
+        x += std::cos(angle);
+        y += std::sin(angle);
+    }
+    return result;
+}
+
+template
+<
+    typename P,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+void test_long_linestring(std::string const& caseid, int n, double distance,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy)
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    linestring const line = make_meander<linestring>(n);
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+
+    boost::timer t;
+
+    multi_polygon buffered;
+    bg::buffer(line, buffered, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+
+    std::cout << caseid
+              << " n=" << n
+              << " distance=" << distance
+              << " area=" << bg::area(buffered)
+              << " polygons=" << buffered.size()
+              << " holes=" << bg::num_interior_rings(buffered)
+              << " points=" << bg::num_points(buffered)
+              << " time=" << t.elapsed() << std::endl;
+}
+
+template <typename P>
+void test_long_linestring(int n, double distance, int points_per_circle,
+                          double max_deviation)
+{
+    // Fixed number of points per circle
+    test_long_linestring<P>("fixed", n, distance,
+        bg::strategy::buffer::join_round(points_per_circle),
+        bg::strategy::buffer::end_round(points_per_circle),
+        bg::strategy::buffer::point_circle(points_per_circle));
+
+    // Number of points calculated from the maximum deviation
+    test_long_linestring<P>("deviation", n, distance,
+        bg::strategy::buffer::join_round_by_deviation(max_deviation),
+        bg::strategy::buffer::end_round_by_deviation(max_deviation),
+        bg::strategy::buffer::point_circle_by_deviation(max_deviation));
+}
+
+int main(int argc, char* argv[])
+{
+    int const n = argc > 1 ? std::atoi(argv[1]) : 20000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point;
+    test_long_linestring<point>(n, 0.5, 36, 0.01);
+    test_long_linestring<point>(n, 2.0, 36, 0.01);
+    test_long_linestring<point>(n, 5.0, 90, 0.01);
+
+    return 0;
+}
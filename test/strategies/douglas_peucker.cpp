@@ -279,6 +279,13 @@ inline void test_with_strategy(std::string label)
                   ba::tuple_list_of(12,-3)(-6,-13)(-12,5)
                   );
 
+    tester::apply("l06" + label,
+                  "LINESTRING(1 1)",
+                  10,
+                  strategy,
+                  ba::tuple_list_of(1,1)
+                  );
+
     {
         segment_type const s(point_type(0,-1), point_type(5,-4));
         point_type const p1(5,-1), p2(0,-4);
@@ -0,0 +1,97 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/cartesian/side_robust.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+
+template <typename Point>
+void test_basic()
+{
+    typedef bg::strategy::side::side_robust<> side;
+
+    Point const p1(1, 1);
+    Point const p2(5, 3);
+
+    BOOST_CHECK_EQUAL( 1, side::apply(p1, p2, Point(2, 4)));
+    BOOST_CHECK_EQUAL(-1, side::apply(p1, p2, Point(4, 0)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p2, Point(3, 2)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p2, Point(9, 5)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p1, Point(9, 5)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p2, p2));
+}
+
+// Points near (0.5, 0.5) on a grid of the smallest representable distance,
+// compared with a line through (12, 12) and (24, 24). A point lies left of
+// that line if its y is larger than its x, which makes the expected
+// result exact. The floating point determinant is wrong (and inconsistent)
+// for many of these points.
+void test_near_degenerate()
+{
+    typedef bg::model::d2::point_xy<double> point;
+    typedef bg::strategy::side::side_robust<> side;
+
+    double const ulp = std::ldexp(1.0, -53);
+    point const q(12, 12);
+    point const r(24, 24);
+
+    int errors = 0;
+    for (int i = 0; i < 256; i++)
+    {
+        for (int j = 0; j < 256; j++)
+        {
+            point const p(0.5 + i * ulp, 0.5 + j * ulp);
+            int const expected = j > i ? 1 : j < i ? -1 : 0;
+
+            // All cyclic permutations should give the same result
+            if (side::apply(q, r, p) != expected
+                || side::apply(r, p, q) != expected
+                || side::apply(p, q, r) != expected
+                || side::apply(r, q, p) != -expected)
+            {
+                errors++;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(errors, 0);
+}
+
+void test_side_value()
+{
+    typedef bg::model::d2::point_xy<double> point;
+    typedef bg::strategy::side::side_robust<> side;
+
+    // Twice the area of the triangle
+    BOOST_CHECK_CLOSE((side::side_value<double, double>(point(0, 0),
+                                point(4, 0), point(0, 3))), 12.0, 0.0001);
+    BOOST_CHECK_CLOSE((side::side_value<double, double>(point(0, 0),
+                                point(0, 3), point(4, 0))), -12.0, 0.0001);
+
+    // Near degenerate: only the sign is exact
+    double const ulp = std::ldexp(1.0, -53);
+    BOOST_CHECK_GT((side::side_value<double, double>(point(12, 12),
+                        point(24, 24), point(0.5, 0.5 + ulp))), 0.0);
+    BOOST_CHECK_EQUAL((side::side_value<double, double>(point(12, 12),
+                        point(24, 24), point(0.5 + ulp, 0.5 + ulp))), 0.0);
+}
+
+int test_main(int, char* [])
+{
+    test_basic<bg::model::d2::point_xy<double> >();
+    test_basic<bg::model::d2::point_xy<float> >();
+    test_basic<bg::model::d2::point_xy<int> >();
+
+    test_near_degenerate();
+    test_side_value();
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2017 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Verifies that overlay and buffer compile and work with side_robust as
+// the default side strategy (which disables rescaling)
+#define BOOST_GEOMETRY_SIDE_ROBUST
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+
+template <typename Point>
+void test_default_strategy()
+{
+    typedef typename bg::strategy::side::services::default_strategy
+        <
+            bg::cartesian_tag
+        >::type side_type;
+    BOOST_CHECK((boost::is_same
+        <
+            side_type, bg::strategy::side::side_robust<>
+        >::value));
+}
+
+template <typename Point>
+void test_overlay()
+{
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    polygon p1, p2;
+    bg::read_wkt("POLYGON((0 0,0 2,2 2,2 0,0 0))", p1);
+    bg::read_wkt("POLYGON((1 1,1 3,3 3,3 1,1 1))", p2);
+
+    multi_polygon intersection, union_result;
+    bg::intersection(p1, p2, intersection);
+    bg::union_(p1, p2, union_result);
+
+    BOOST_CHECK_EQUAL(intersection.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(intersection), 1.0, 0.0001);
+    BOOST_CHECK_EQUAL(union_result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(union_result), 7.0, 0.0001);
+}
+
+template <typename Point>
+void test_buffer()
+{
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<Point> linestring;
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(0.5);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_miter join_strategy;
+    bg::strategy::buffer::end_flat end_strategy;
+    bg::strategy::buffer::point_square point_strategy;
+
+    // A concave polygon, its buffer has turns
+    polygon l_shape;
+    bg::read_wkt("POLYGON((0 0,0 3,1 3,1 1,3 1,3 0,0 0))", l_shape);
+    multi_polygon result;
+    bg::buffer(l_shape, result, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(result), 12.0, 0.0001);
+
+    linestring line;
+    bg::read_wkt("LINESTRING(0 0,4 0)", line);
+    result.clear();
+    bg::buffer(line, result, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+    BOOST_CHECK_EQUAL(result.size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(result), 4.0, 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point;
+
+    test_default_strategy<point>();
+    test_overlay<point>();
+    test_buffer<point>();
+
+    return 0;
+}